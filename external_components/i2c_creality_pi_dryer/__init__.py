@@ -11,8 +11,10 @@ Component Type: External Component
 
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import sensor, text_sensor
-from esphome.const import CONF_ID
+from esphome.components import sensor, text_sensor, web_server_base
+from esphome.components.esp32 import add_idf_sdkconfig_option
+from esphome.const import CONF_ID, CONF_HOST, CONF_PORT, CONF_MODEL
+from esphome.core import CORE
 
 # Component dependencies and auto-loading
 # DEPENDENCIES: List of other ESPHome components this component depends on (empty = no dependencies)
@@ -20,12 +22,39 @@ from esphome.const import CONF_ID
 DEPENDENCIES = []
 AUTO_LOAD = []
 
+# Supported dryer models
+# Maps the `model:` option to the protocol descriptor define (see dryer_protocol.h)
+MODELS = {
+    "space_pi_plus": "USE_CREALITY_DRYER_MODEL_SPACE_PI_PLUS",
+}
+
 # Configuration constants
 # These define the YAML configuration keys that users can specify
 CONF_SCL_PIN = "scl_pin"                    # I2C clock line GPIO pin
 CONF_SDA_PIN = "sda_pin"                    # I2C data line GPIO pin
 CONF_ENABLE_PULLUP = "enable_pullup"        # Enable internal pull-up resistors on I2C pins
 CONF_ENABLE_STATISTICS = "enable_statistics"  # Enable packet statistics tracking
+CONF_FAST_ISR = "fast_isr"                  # Register-level ISRs with cycle-counter timestamps
+CONF_TELEMETRY = "telemetry"                # Binary UDP telemetry stream of raw frames
+CONF_BATCH_SIZE = "batch_size"              # Frames per telemetry datagram
+CONF_DISPLAY_MIRROR = "display_mirror"      # Serve segment-level LCD mirror at /dryer/display
+CONF_UNKNOWN_PATTERNS = "unknown_patterns"  # Serve unrecognized field patterns at /dryer/unknown
+CONF_SESSIONS = "sessions"                  # Drying session history persisted in NVS
+CONF_LAST_SESSION = "last_session_id"       # Last finished session (JSON) text sensor
+CONF_SESSION_COUNT = "session_count_id"     # Number of recorded sessions sensor
+CONF_ERROR_HISTORY = "error_history"        # Error episode ring and per-code counters
+CONF_EPISODES = "episodes_id"               # Error episodes since boot sensor
+CONF_LAST_EPISODE = "last_episode_id"       # Last error episode (JSON) text sensor
+CONF_CODE_COUNTS = "code_counts"            # Episodes per error code (E0..E10) sensors
+CONF_RECORDER = "recorder"                  # Raw frame recorder in a flash partition
+CONF_PARTITION = "partition"                # Data partition label used by the recorder
+CONF_BUS_LOGGER = "bus_logger"              # Passive I2C transaction log served at /dryer/bus
+CONF_ADDRESSES = "addresses"                # 7-bit addresses logged by the bus logger (empty = all)
+CONF_FILTERS = "filters"                    # Value filter thresholds (see tools/filter_tuner.py)
+CONF_LOW_POWER_IDLE = "low_power_idle"      # Disable the loop while the dryer is off
+CONF_ENTER_DELAY = "enter_delay"            # Time off before entering low-power idle
+CONF_LIGHT_SLEEP = "light_sleep"            # Allow automatic light sleep while idle
+CONF_WEB_SERVER_BASE_ID = "web_server_base_id"  # Web server used for diagnostic endpoints
 
 # Sensor ID mapping constants
 # These link the component's internal sensors to user-defined sensor IDs in YAML
@@ -38,18 +67,156 @@ CONF_CURSOR = "cursor_id"                  # Menu cursor position text sensor
 CONF_TEMP_UNITS = "temp_units_id"          # Temperature units (C/F) text sensor
 CONF_ERROR_STATUS = "error_status_id"      # Error code/status text sensor
 CONF_DRYER_STATUS = "dryer_status_id"      # Dryer operational status text sensor
+CONF_SNAPSHOT = "snapshot_id"              # Aggregated JSON snapshot text sensor (optional)
 
 # Namespace and class definition
 # Creates the C++ namespace and class reference for code generation
 i2c_creality_pi_dryer_ns = cg.esphome_ns.namespace("i2c_creality_pi_dryer")
 I2CCrealityPiDryer = i2c_creality_pi_dryer_ns.class_("I2CCrealityPiDryer", cg.Component)
 
+# Telemetry schema
+# Streams delta-encoded raw frames to a UDP receiver (see tools/telemetry_receiver.py)
+TELEMETRY_SCHEMA = cv.Schema({
+    cv.Required(CONF_HOST): cv.ipv4address,
+    cv.Optional(CONF_PORT, default=5140): cv.port,
+    # Max frames per datagram; partial batches are flushed after 1 second
+    cv.Optional(CONF_BATCH_SIZE, default=16): cv.int_range(min=1, max=32),
+})
+
+# Recorder schema
+# Records every frame into a data partition (see tools/recording_tool.py)
+# The partition must be declared in a custom partition table, e.g.
+#   dryer_rec, data, 0x40, , 256K
+RECORDER_SCHEMA = cv.Schema({
+    cv.Optional(CONF_PARTITION, default="dryer_rec"): cv.All(cv.string, cv.Length(min=1, max=15)),
+})
+
+# Filter schema
+# Consecutive identical readings required before a value is published, jump
+# thresholds for the temperatures and error confirm/clear counts. Defaults are
+# the hand-tuned values; tools/filter_tuner.py derives a block from recorded traces.
+FILTER_REPEATS = {
+    "set_temp_repeats": 5,
+    "current_temp_repeats": 5,
+    "humidity_repeats": 3,
+    "drying_time_repeats": 2,
+    "material_repeats": 10,
+    "cursor_repeats": 3,
+}
+FILTER_JUMPS = {
+    "set_temp_max_jump": 5,             # Larger set temperature steps are rejected (without plausibility)
+    "current_temp_max_jump": 5,         # Larger current temperature steps need current_temp_jump_repeats
+    "current_temp_jump_repeats": 10,
+}
+ERROR_REPEATS = {
+    "error_confirm_repeats": 3,
+    "error_clear_repeats": 10,
+}
+# Plausibility models: readings the display would show next (countdown tick,
+# one-degree PV step within max_rate, SV knob step while edited) need fewer
+# repeats, SV/time jumps without the cursor on them must persist. Opt-in,
+# since a genuine jump the models cannot explain then takes implausible_repeats
+# frames to show
+CONF_PLAUSIBILITY = "plausibility"
+FILTER_MODELS = {
+    "set_temp_plausible_repeats": 2,
+    "current_temp_plausible_repeats": 2,
+    "drying_time_plausible_repeats": 2,
+    "implausible_repeats": 30,
+    "current_temp_max_rate": 10,        # Degrees per minute
+    "drying_time_tolerance": 2,         # Seconds
+}
+FILTERS_SCHEMA = cv.Schema({
+    cv.Optional(CONF_PLAUSIBILITY, default=False): cv.boolean,
+    **{cv.Optional(key, default=value): cv.int_range(min=1, max=100) for key, value in FILTER_MODELS.items()},
+    **{cv.Optional(key, default=value): cv.int_range(min=1, max=100) for key, value in FILTER_REPEATS.items()},
+    **{cv.Optional(key, default=value): cv.int_range(min=1, max=100) for key, value in FILTER_JUMPS.items()},
+    **{cv.Optional(key, default=value): cv.int_range(min=1, max=100) for key, value in ERROR_REPEATS.items()},
+})
+
+# Low-power idle schema
+# After the dryer has been off for enter_delay the component disables its loop
+# and leaves only the SCL edge interrupt armed; the first bus edge resumes full
+# capture within one main loop pass. With light_sleep the chip may also enter
+# automatic light sleep meanwhile (ESP-IDF only; enables power management and
+# tickless idle, and Wi-Fi needs power_save_mode: light to stay connected)
+LOW_POWER_IDLE_SCHEMA = cv.Schema({
+    # At least 2 s, so pending telemetry/recorder batches are flushed first
+    cv.Optional(CONF_ENTER_DELAY, default="5s"): cv.All(
+        cv.positive_time_period_milliseconds, cv.Range(min=cv.TimePeriod(seconds=2))),
+    cv.Optional(CONF_LIGHT_SLEEP, default=False): cv.boolean,
+})
+
+# Bus logger schema
+# Logs every transaction on the sniffed bus (address, R/W, ACK/NACK per byte,
+# data, timing) into a 64-entry RAM ring; other addresses are dropped in the ISR
+BUS_LOGGER_SCHEMA = cv.Schema({
+    cv.Optional(CONF_ADDRESSES, default=[]): cv.ensure_list(cv.i2c_address),
+})
+
+# Sessions schema
+# One record per drying run (start, duration, material, set temperature,
+# humidity, errors, outcome); the last 16 are kept in NVS
+SESSIONS_SCHEMA = cv.Schema({
+    cv.Optional(CONF_LAST_SESSION): cv.use_id(text_sensor.TextSensor),
+    cv.Optional(CONF_SESSION_COUNT): cv.use_id(sensor.Sensor),
+})
+
+# Error history schema
+# Last 8 error episodes (code, start, duration, peak repeats) and per-code
+# counters since boot; sensors are updated at episode boundaries only
+ERROR_CODES = [f"E{code}" for code in range(11)]  # Index = code (ERROR_NAMES in dryer_errors.h)
+ERROR_HISTORY_SCHEMA = cv.Schema({
+    cv.Optional(CONF_EPISODES): cv.use_id(sensor.Sensor),
+    cv.Optional(CONF_LAST_EPISODE): cv.use_id(text_sensor.TextSensor),
+    cv.Optional(CONF_CODE_COUNTS): cv.Schema({
+        cv.Optional(name): cv.use_id(sensor.Sensor) for name in ERROR_CODES
+    }),
+})
+
+# Features that expose diagnostic endpoints under /dryer/ on web_server
+WEB_FEATURES = [CONF_DISPLAY_MIRROR, CONF_UNKNOWN_PATTERNS, CONF_RECORDER, CONF_BUS_LOGGER]
+# Features that also serve an endpoint when web_server happens to be configured
+OPTIONAL_WEB_FEATURES = [CONF_SESSIONS, CONF_ERROR_HISTORY]
+
+
+def uses_web(config):
+    if CONF_WEB_SERVER_BASE_ID in config and any(feature in config for feature in OPTIONAL_WEB_FEATURES):
+        return True
+    return any(config.get(feature) for feature in WEB_FEATURES)
+
+
+def validate_web_endpoints(config):
+    """Diagnostic endpoints are served by web_server, so it must be configured"""
+    if uses_web(config) and CONF_WEB_SERVER_BASE_ID not in config:
+        enabled = ", ".join(f"'{feature}'" for feature in WEB_FEATURES if config.get(feature))
+        raise cv.Invalid(f"{enabled} requires the web_server component")
+    return config
+
+
+def validate_light_sleep(config):
+    """Automatic light sleep is configured through ESP-IDF power management"""
+    if config.get(CONF_LOW_POWER_IDLE, {}).get(CONF_LIGHT_SLEEP) and not CORE.using_esp_idf:
+        raise cv.Invalid(f"'{CONF_LIGHT_SLEEP}' requires the esp-idf framework")
+    return config
+
+
+def validate_recorder(config):
+    """Sector downloads are sent from a heap buffer, which only the esp-idf web server sends before returning"""
+    if CONF_RECORDER in config and not CORE.using_esp_idf:
+        raise cv.Invalid(f"'{CONF_RECORDER}' requires the esp-idf framework")
+    return config
+
+
 # Configuration schema
 # Defines the structure and validation rules for YAML configuration
-CONFIG_SCHEMA = cv.Schema({
+CONFIG_SCHEMA = cv.All(cv.Schema({
     # Component ID - automatically generated or user-specified
     cv.GenerateID(): cv.declare_id(I2CCrealityPiDryer),
     
+    # Dryer model (selects the compile-time protocol descriptor)
+    cv.Optional(CONF_MODEL, default="space_pi_plus"): cv.one_of(*MODELS, lower=True),
+    
     # GPIO pin configuration
     # Optional: User can override default pins (GPIO22 for SCL, GPIO21 for SDA)
     # Valid range: 0-39 (ESP32 GPIO pin numbers)
@@ -60,23 +227,52 @@ CONFIG_SCHEMA = cv.Schema({
     # Optional: Enable/disable internal pull-up resistors (default: disabled)
     cv.Optional(CONF_ENABLE_PULLUP, default=False): cv.boolean,
     # Optional: Enable/disable packet statistics logging (default: disabled)
+    # Logs a JSON line with per-stage timings, publish rate and time-to-first-publish
+    # every 30 seconds (compare captures with tools/bench_compare.py)
     cv.Optional(CONF_ENABLE_STATISTICS, default=False): cv.boolean,
+    # Optional: Read the pins straight from the GPIO input register and stamp edges
+    # with the CPU cycle counter in the ISRs (default: disabled, GPIO driver calls)
+    cv.Optional(CONF_FAST_ISR, default=False): cv.boolean,
+    # Optional: Filter thresholds (default: hand-tuned values, see FILTERS_SCHEMA)
+    cv.Optional(CONF_FILTERS): FILTERS_SCHEMA,
+    # Optional: Low-power idle while the dryer is off (default: disabled)
+    cv.Optional(CONF_LOW_POWER_IDLE): LOW_POWER_IDLE_SCHEMA,
+    # Optional: Binary UDP telemetry stream of decoded frames (default: disabled)
+    cv.Optional(CONF_TELEMETRY): TELEMETRY_SCHEMA,
+    # Optional: Serve a segment-level mirror of the LCD at /dryer/display (default: disabled)
+    cv.Optional(CONF_DISPLAY_MIRROR, default=False): cv.boolean,
+    # Optional: Collect unrecognized cursor/units/material/error patterns at /dryer/unknown (default: disabled)
+    cv.Optional(CONF_UNKNOWN_PATTERNS, default=False): cv.boolean,
+    # Optional: Drying session history, served at /dryer/sessions when web_server is present
+    cv.Optional(CONF_SESSIONS): SESSIONS_SCHEMA,
+    # Optional: Error episode history, served at /dryer/errors when web_server is present
+    cv.Optional(CONF_ERROR_HISTORY): ERROR_HISTORY_SCHEMA,
+    # Optional: Record raw frames to flash, downloadable at /dryer/recording (default: disabled)
+    cv.Optional(CONF_RECORDER): RECORDER_SCHEMA,
+    # Optional: Log all I2C transactions on the bus at /dryer/bus (default: disabled)
+    cv.Optional(CONF_BUS_LOGGER): BUS_LOGGER_SCHEMA,
+    # Web server for diagnostic endpoints (picked up automatically when web_server is configured)
+    cv.OnlyWith(CONF_WEB_SERVER_BASE_ID, "web_server_base"): cv.use_id(web_server_base.WebServerBase),
     
-    # Required sensor references
-    # These must be defined in the YAML configuration and linked to actual sensors
+    # Optional sensor references
+    # Only configured channels are compiled in: decode, filtering and publishing
+    # of omitted channels is removed at build time (see USE_CREALITY_DRYER_* defines)
     # Numeric sensors (temperature and humidity)
-    cv.Required(CONF_SET_TEMP): cv.use_id(sensor.Sensor),
-    cv.Required(CONF_CURRENT_TEMP): cv.use_id(sensor.Sensor),
-    cv.Required(CONF_HUMIDITY): cv.use_id(sensor.Sensor),
+    cv.Optional(CONF_SET_TEMP): cv.use_id(sensor.Sensor),
+    cv.Optional(CONF_CURRENT_TEMP): cv.use_id(sensor.Sensor),
+    cv.Optional(CONF_HUMIDITY): cv.use_id(sensor.Sensor),
     
     # Text sensors (time, material, states, errors)
-    cv.Required(CONF_DRYING_TIME): cv.use_id(text_sensor.TextSensor),
-    cv.Required(CONF_MATERIAL): cv.use_id(text_sensor.TextSensor),
-    cv.Required(CONF_CURSOR): cv.use_id(text_sensor.TextSensor),
-    cv.Required(CONF_TEMP_UNITS): cv.use_id(text_sensor.TextSensor),
-    cv.Required(CONF_ERROR_STATUS): cv.use_id(text_sensor.TextSensor),
-    cv.Required(CONF_DRYER_STATUS): cv.use_id(text_sensor.TextSensor),
-}).extend(cv.COMPONENT_SCHEMA)  # Extend with standard component schema (includes setup_priority, etc.)
+    cv.Optional(CONF_DRYING_TIME): cv.use_id(text_sensor.TextSensor),
+    cv.Optional(CONF_MATERIAL): cv.use_id(text_sensor.TextSensor),
+    cv.Optional(CONF_CURSOR): cv.use_id(text_sensor.TextSensor),
+    cv.Optional(CONF_TEMP_UNITS): cv.use_id(text_sensor.TextSensor),
+    cv.Optional(CONF_ERROR_STATUS): cv.use_id(text_sensor.TextSensor),
+    cv.Optional(CONF_DRYER_STATUS): cv.use_id(text_sensor.TextSensor),
+    
+    # Optional aggregated snapshot (one JSON message per confirmed change set)
+    cv.Optional(CONF_SNAPSHOT): cv.use_id(text_sensor.TextSensor),
+}).extend(cv.COMPONENT_SCHEMA), validate_web_endpoints, validate_light_sleep, validate_recorder)  # Extend with standard component schema (includes setup_priority, etc.)
 
 
 async def to_code(config):
@@ -87,6 +283,9 @@ async def to_code(config):
     # Register this as an ESPHome component (enables setup(), loop(), etc.)
     await cg.register_component(var, config)
 
+    # Select protocol descriptor for the configured dryer model
+    cg.add_define(MODELS[config[CONF_MODEL]])
+
     # Configure GPIO pins for I2C monitoring
     # These setter calls generate C++ code: var->set_scl_pin(22);
     cg.add(var.set_scl_pin(config[CONF_SCL_PIN]))
@@ -95,45 +294,137 @@ async def to_code(config):
     # Configure feature flags
     cg.add(var.set_enable_pullup(config[CONF_ENABLE_PULLUP]))
     cg.add(var.set_enable_statistics(config[CONF_ENABLE_STATISTICS]))
+    if config[CONF_FAST_ISR]:
+        cg.add_define("USE_CREALITY_DRYER_FAST_ISR")
+
+    # Configure filter thresholds (C++ defaults match the schema defaults)
+    if CONF_FILTERS in config:
+        filters = config[CONF_FILTERS]
+        cg.add(var.set_filter_repeats(*(filters[key] for key in FILTER_REPEATS)))
+        cg.add(var.set_filter_jumps(*(filters[key] for key in FILTER_JUMPS)))
+        cg.add(var.set_error_repeats(*(filters[key] for key in ERROR_REPEATS)))
+        cg.add(var.set_filter_models(filters[CONF_PLAUSIBILITY], *(filters[key] for key in FILTER_MODELS)))
+
+    # Configure low-power idle
+    if CONF_LOW_POWER_IDLE in config:
+        idle = config[CONF_LOW_POWER_IDLE]
+        cg.add_define("USE_CREALITY_DRYER_IDLE")
+        cg.add(var.set_idle_enter_delay(idle[CONF_ENTER_DELAY]))
+        if idle[CONF_LIGHT_SLEEP]:
+            cg.add_define("USE_CREALITY_DRYER_LIGHT_SLEEP")
+            add_idf_sdkconfig_option("CONFIG_PM_ENABLE", True)
+            add_idf_sdkconfig_option("CONFIG_FREERTOS_USE_TICKLESS_IDLE", True)
+
+    # Configure UDP telemetry stream
+    if CONF_TELEMETRY in config:
+        cg.add_define("USE_CREALITY_DRYER_TELEMETRY")
+        telemetry = config[CONF_TELEMETRY]
+        cg.add(var.set_telemetry(str(telemetry[CONF_HOST]), telemetry[CONF_PORT], telemetry[CONF_BATCH_SIZE]))
+
+    # Configure drying session tracking (history in NVS, optional sensors)
+    if CONF_SESSIONS in config:
+        cg.add_define("USE_CREALITY_DRYER_SESSIONS")
+        sessions = config[CONF_SESSIONS]
+        if CONF_LAST_SESSION in sessions:
+            last_session = await cg.get_variable(sessions[CONF_LAST_SESSION])
+            cg.add(var.set_last_session_sensor(last_session))
+        if CONF_SESSION_COUNT in sessions:
+            session_count = await cg.get_variable(sessions[CONF_SESSION_COUNT])
+            cg.add(var.set_session_count_sensor(session_count))
+
+    # Configure error episode history (optional diagnostic sensors)
+    if CONF_ERROR_HISTORY in config:
+        cg.add_define("USE_CREALITY_DRYER_ERROR_HISTORY")
+        error_history = config[CONF_ERROR_HISTORY]
+        if CONF_EPISODES in error_history:
+            episodes = await cg.get_variable(error_history[CONF_EPISODES])
+            cg.add(var.set_error_episodes_sensor(episodes))
+        if CONF_LAST_EPISODE in error_history:
+            last_episode = await cg.get_variable(error_history[CONF_LAST_EPISODE])
+            cg.add(var.set_last_error_episode_sensor(last_episode))
+        for name, sensor_id in error_history.get(CONF_CODE_COUNTS, {}).items():
+            code_count = await cg.get_variable(sensor_id)
+            cg.add(var.set_error_code_count_sensor(ERROR_CODES.index(name), code_count))
+
+    # Configure diagnostic web endpoints
+    if config[CONF_DISPLAY_MIRROR]:
+        cg.add_define("USE_CREALITY_DRYER_DISPLAY_MIRROR")
+    if config[CONF_UNKNOWN_PATTERNS]:
+        cg.add_define("USE_CREALITY_DRYER_UNKNOWN_PATTERNS")
+    if CONF_RECORDER in config:
+        cg.add_define("USE_CREALITY_DRYER_RECORDER")
+        cg.add(var.set_recorder_partition(config[CONF_RECORDER][CONF_PARTITION]))
+    if CONF_BUS_LOGGER in config:
+        cg.add_define("USE_CREALITY_DRYER_BUS_LOGGER")
+        for address in config[CONF_BUS_LOGGER][CONF_ADDRESSES]:
+            cg.add(var.add_bus_logger_address(address))
+    if uses_web(config):
+        cg.add_define("USE_CREALITY_DRYER_WEB")
+        base = await cg.get_variable(config[CONF_WEB_SERVER_BASE_ID])
+        cg.add(var.set_web_server_base(base))
 
     # Link numeric sensors
     # Retrieve sensor references from config and link them to the component
+    # Each configured channel also emits a define that compiles its code path in
     
     # Set temperature sensor (target/desired temperature)
-    set_temp = await cg.get_variable(config[CONF_SET_TEMP])
-    cg.add(var.set_set_temp_sensor(set_temp))
+    if CONF_SET_TEMP in config:
+        cg.add_define("USE_CREALITY_DRYER_SET_TEMP")
+        set_temp = await cg.get_variable(config[CONF_SET_TEMP])
+        cg.add(var.set_set_temp_sensor(set_temp))
 
     # Current temperature sensor (measured/process temperature)
-    current_temp = await cg.get_variable(config[CONF_CURRENT_TEMP])
-    cg.add(var.set_current_temp_sensor(current_temp))
+    if CONF_CURRENT_TEMP in config:
+        cg.add_define("USE_CREALITY_DRYER_CURRENT_TEMP")
+        current_temp = await cg.get_variable(config[CONF_CURRENT_TEMP])
+        cg.add(var.set_current_temp_sensor(current_temp))
 
     # Humidity sensor (relative humidity percentage)
-    humidity = await cg.get_variable(config[CONF_HUMIDITY])
-    cg.add(var.set_humidity_sensor(humidity))
+    if CONF_HUMIDITY in config:
+        cg.add_define("USE_CREALITY_DRYER_HUMIDITY")
+        humidity = await cg.get_variable(config[CONF_HUMIDITY])
+        cg.add(var.set_humidity_sensor(humidity))
 
     # Link text sensors
     # Retrieve text sensor references and link them to the component
     
     # Drying time sensor (format: HH:MM:SS)
-    drying_time = await cg.get_variable(config[CONF_DRYING_TIME])
-    cg.add(var.set_drying_time_sensor(drying_time))
+    if CONF_DRYING_TIME in config:
+        cg.add_define("USE_CREALITY_DRYER_DRYING_TIME")
+        drying_time = await cg.get_variable(config[CONF_DRYING_TIME])
+        cg.add(var.set_drying_time_sensor(drying_time))
 
     # Material type sensor (e.g., "PLA", "ABS", "PETG")
-    material = await cg.get_variable(config[CONF_MATERIAL])
-    cg.add(var.set_material_sensor(material))
+    if CONF_MATERIAL in config:
+        cg.add_define("USE_CREALITY_DRYER_MATERIAL")
+        material = await cg.get_variable(config[CONF_MATERIAL])
+        cg.add(var.set_material_sensor(material))
 
     # Cursor position sensor (e.g., "Idle", "Time", "Material", "SV", "PV")
-    cursor = await cg.get_variable(config[CONF_CURSOR])
-    cg.add(var.set_cursor_sensor(cursor))
+    if CONF_CURSOR in config:
+        cg.add_define("USE_CREALITY_DRYER_CURSOR")
+        cursor = await cg.get_variable(config[CONF_CURSOR])
+        cg.add(var.set_cursor_sensor(cursor))
 
     # Temperature units sensor (displays "C" or "F")
-    temp_units = await cg.get_variable(config[CONF_TEMP_UNITS])
-    cg.add(var.set_temp_units_sensor(temp_units))
+    if CONF_TEMP_UNITS in config:
+        cg.add_define("USE_CREALITY_DRYER_TEMP_UNITS")
+        temp_units = await cg.get_variable(config[CONF_TEMP_UNITS])
+        cg.add(var.set_temp_units_sensor(temp_units))
 
     # Error status sensor (displays error codes like "E0", "E5", or "OK")
-    error_status = await cg.get_variable(config[CONF_ERROR_STATUS])
-    cg.add(var.set_error_status_sensor(error_status))
+    if CONF_ERROR_STATUS in config:
+        cg.add_define("USE_CREALITY_DRYER_ERROR_STATUS")
+        error_status = await cg.get_variable(config[CONF_ERROR_STATUS])
+        cg.add(var.set_error_status_sensor(error_status))
     
     # Dryer operational status sensor (displays "Off", "Idle", "Drying", or "Error")
-    dryer_status = await cg.get_variable(config[CONF_DRYER_STATUS])
-    cg.add(var.set_dryer_status_sensor(dryer_status))
+    if CONF_DRYER_STATUS in config:
+        cg.add_define("USE_CREALITY_DRYER_DRYER_STATUS")
+        dryer_status = await cg.get_variable(config[CONF_DRYER_STATUS])
+        cg.add(var.set_dryer_status_sensor(dryer_status))
+
+    # Aggregated snapshot sensor (optional, JSON with all channels + change set number)
+    if CONF_SNAPSHOT in config:
+        snapshot = await cg.get_variable(config[CONF_SNAPSHOT])
+        cg.add(var.set_snapshot_sensor(snapshot))
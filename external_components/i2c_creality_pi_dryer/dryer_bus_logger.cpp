@@ -0,0 +1,65 @@
+#include "dryer_bus_logger.h"
+#include <cstdio>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+/**
+ * Lock-free copy of one ring slot
+ * The slot at head_ % RING_SIZE belongs to the ISR (open transaction), so a
+ * copy is valid only if that slot did not reach it before or during the copy.
+ */
+bool BusLogger::read(uint32_t index, BusTransaction &out) const {
+    uint32_t head = head_;
+    if (index >= head || head - index >= RING_SIZE) return false;
+    __sync_synchronize();
+    out = ring_[index % RING_SIZE];
+    __sync_synchronize();
+    return head_ - index < RING_SIZE;
+}
+
+/**
+ * Render as JSON
+ * "ack" holds one character per byte (address first): A = ACK, N = NACK
+ */
+void BusLogger::render(std::string &out, uint32_t since) const {
+    char line[160];
+    uint32_t head = head_;
+    uint32_t first = head > RING_SIZE - 1 ? head - (RING_SIZE - 1) : 0;
+    if (since > first) first = since;
+
+    snprintf(line, sizeof(line), "{\"captured\":%u,\"filtered\":%u,\"next\":%u,\"transactions\":[",
+             (unsigned)head, (unsigned)filtered_count_, (unsigned)head);
+    out = line;
+
+    bool comma = false;
+    BusTransaction t;
+    for (uint32_t index = first; index < head; index++) {
+        if (!read(index, t)) continue;   // Overwritten while rendering
+
+        uint8_t stored = t.length < BusTransaction::MAX_DATA ? t.length : BusTransaction::MAX_DATA;
+        char data[2 * BusTransaction::MAX_DATA + 1];
+        char ack[BusTransaction::MAX_DATA + 2];
+        for (uint8_t i = 0; i < stored; i++) snprintf(data + 2 * i, 3, "%02X", t.data[i]);
+        data[2 * stored] = '\0';
+        for (uint8_t i = 0; i <= stored; i++) ack[i] = (t.nack_mask & (1u << i)) ? 'N' : 'A';
+        ack[stored + 1] = '\0';
+
+        snprintf(line, sizeof(line),
+                 "%s{\"n\":%u,\"t_us\":%u,\"dur_us\":%u,\"addr\":\"0x%02X\",\"rw\":\"%c\",\"len\":%u,\"data\":\"",
+                 comma ? "," : "", (unsigned)index, (unsigned)t.start_us, (unsigned)t.duration_us, t.address,
+                 (t.flags & BusTransaction::FLAG_READ) ? 'R' : 'W', (unsigned)t.length);
+        out += line;
+        out += data;
+        snprintf(line, sizeof(line), "\",\"ack\":\"%s\",\"repeated_start\":%s,\"stop\":%s,\"truncated\":%s}", ack,
+                 (t.flags & BusTransaction::FLAG_REPEATED_START) ? "true" : "false",
+                 (t.flags & BusTransaction::FLAG_NO_STOP) ? "false" : "true",
+                 (t.flags & BusTransaction::FLAG_TRUNCATED) ? "true" : "false");
+        out += line;
+        comma = true;
+    }
+    out += "]}";
+}
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
@@ -0,0 +1,170 @@
+#pragma once
+#include "esphome/core/hal.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+/**
+ * One logged I2C transaction (START to STOP or repeated START)
+ */
+struct BusTransaction {
+    static constexpr uint8_t MAX_DATA = 31;    // Data bytes kept (address + 31 = one NACK mask word)
+
+    uint32_t start_us;       // micros() of the START condition
+    uint32_t duration_us;    // START to STOP (or to the last edge before the next START)
+    uint32_t nack_mask;      // Bit n set = byte n was NACKed (bit 0 = address byte)
+    uint8_t address;         // 7-bit target address
+    uint8_t flags;           // FLAG_* below
+    uint8_t length;          // Data bytes after the address byte (saturates at 255)
+    uint8_t reserved;
+    uint8_t data[MAX_DATA];  // First MAX_DATA data bytes
+
+    static constexpr uint8_t FLAG_READ = 0x01;             // R/W bit of the address byte
+    static constexpr uint8_t FLAG_REPEATED_START = 0x02;   // Started without a STOP before it
+    static constexpr uint8_t FLAG_NO_STOP = 0x04;          // Ended by a (repeated) START instead of a STOP
+    static constexpr uint8_t FLAG_TRUNCATED = 0x08;        // More than MAX_DATA data bytes
+};
+
+/**
+ * Passive I2C transaction logger
+ *
+ * General-purpose mode of the sniffer's capture engine: logs every
+ * transaction on the bus (any address, reads and writes, per-byte ACK/NACK,
+ * repeated starts, timing) into a bounded RAM ring, independent of the
+ * dryer frame path. Addresses are filtered in the ISR right after the
+ * address byte, so filtered traffic costs one bitmap test per transaction
+ * and never touches the ring.
+ *
+ * The on_*() methods run in the GPIO ISRs and keep their own bit position,
+ * so frame processing in loop() cannot disturb them. The ISR writes the open
+ * transaction directly into the next ring slot and publishes it by advancing
+ * head_; readers copy slots without locking and drop any slot the ISR may
+ * have started to overwrite during the copy.
+ */
+class BusLogger {
+ public:
+  static constexpr uint8_t RING_SIZE = 64;     // Transactions kept (48 bytes each)
+
+  /**
+   * Log only the given 7-bit address (may be called repeatedly)
+   * Without any call every address is logged.
+   */
+  void add_address(uint8_t address) {
+    if (!filtered_) {
+      for (auto &word : filter_) word = 0;
+      filtered_ = true;
+    }
+    filter_[(address & 0x7F) >> 5] |= 1u << (address & 31);
+  }
+  bool is_filtered() const { return filtered_; }
+
+  // --- ISR side ------------------------------------------------------------
+
+  /**
+   * START condition (also a repeated START)
+   * @param now_us Time of the START
+   * @param last_edge_us Time of the previous bus edge (end of an open transaction)
+   */
+  inline void IRAM_ATTR on_start(uint32_t now_us, uint32_t last_edge_us) {
+    bool repeated = open_;
+    if (capturing_) commit(last_edge_us, BusTransaction::FLAG_NO_STOP);
+    BusTransaction &t = ring_[head_ % RING_SIZE];
+    t.start_us = now_us;
+    t.nack_mask = 0;
+    t.flags = repeated ? BusTransaction::FLAG_REPEATED_START : 0;
+    t.length = 0;
+    open_ = true;
+    capturing_ = true;
+    addressed_ = false;
+    bit_ = 0;
+    shift_ = 0;
+  }
+
+  /**
+   * STOP condition
+   */
+  inline void IRAM_ATTR on_stop(uint32_t now_us) {
+    open_ = false;
+    if (capturing_) commit(now_us, 0);
+  }
+
+  /**
+   * SCL rising edge while a transaction is being captured
+   * @param sda SDA level (data bit, or 0 = ACK / 1 = NACK on the ninth clock)
+   */
+  inline void IRAM_ATTR on_clock(int sda) {
+    BusTransaction &t = ring_[head_ % RING_SIZE];
+    if (bit_ < 8) {
+      shift_ = (shift_ << 1) | (sda & 1);
+      if (++bit_ < 8) return;
+      if (!addressed_) {
+        uint8_t address = shift_ >> 1;
+        if (!(filter_[address >> 5] & (1u << (address & 31)))) {
+          capturing_ = false;   // Ignore the rest until the next START
+          filtered_count_++;
+          return;
+        }
+        t.address = address;
+        if (shift_ & 1) t.flags |= BusTransaction::FLAG_READ;
+        addressed_ = true;
+        return;
+      }
+      if (t.length < BusTransaction::MAX_DATA) t.data[t.length] = shift_;
+      else t.flags |= BusTransaction::FLAG_TRUNCATED;
+      if (t.length < 255) t.length++;
+      return;
+    }
+    // Ninth clock: acknowledge of the byte just received (index 0 = address)
+    if (sda && t.length < 32) t.nack_mask |= 1u << t.length;
+    bit_ = 0;
+    shift_ = 0;
+  }
+
+  bool is_capturing() const { return capturing_; }
+
+  // --- Reader side ---------------------------------------------------------
+
+  uint32_t get_captured() const { return head_; }
+  uint32_t get_filtered() const { return filtered_count_; }
+
+  /**
+   * Copy one logged transaction
+   * @param index Transaction number (0 = first since boot)
+   * @return false if the transaction is no longer (or not yet) in the ring
+   */
+  bool read(uint32_t index, BusTransaction &out) const;
+
+  /**
+   * Render logged transactions as JSON
+   * @param since First transaction number to include (older ones are skipped)
+   */
+  void render(std::string &out, uint32_t since) const;
+
+ protected:
+  inline void IRAM_ATTR commit(uint32_t end_us, uint8_t flags) {
+    capturing_ = false;
+    if (!addressed_) return;   // START immediately followed by STOP/START
+    BusTransaction &t = ring_[head_ % RING_SIZE];
+    t.duration_us = end_us - t.start_us;
+    t.flags |= flags;
+    __sync_synchronize();      // Slot contents visible before the new head
+    head_ = head_ + 1;
+  }
+
+  BusTransaction ring_[RING_SIZE]{};
+  volatile uint32_t head_{0};              // Transactions committed since boot
+  volatile uint32_t filtered_count_{0};    // Transactions dropped by the address filter
+  uint32_t filter_[4]{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF};  // Address bitmap
+  bool filtered_{false};                   // Address filter configured
+  volatile bool open_{false};              // Between START and STOP on the bus
+  volatile bool capturing_{false};         // Recording the open transaction
+  volatile bool addressed_{false};         // Address byte received
+  volatile uint8_t bit_{0};                // Clock within the current byte (8 = ACK)
+  volatile uint8_t shift_{0};              // Byte being assembled
+};
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
@@ -0,0 +1,178 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+// Bus capture state machine
+// Shared by the driver-based and the register-level (fast_isr) ISRs and free
+// of ESPHome dependencies, so it can be driven by synthetic edges on the host.
+
+// Force inlining into the calling ISR (which is placed in IRAM)
+#define CREALITY_DRYER_CAPTURE_INLINE inline __attribute__((always_inline))
+
+/**
+ * I2C communication status
+ * Tracks the current state of I2C packet reception
+ */
+enum class I2CStatus : uint8_t {
+    READY = 0,      // Ready to receive new data
+    RECEIVING = 1,  // Currently receiving I2C packet
+    STOP = 2,       // Stop condition detected, packet complete
+    BUSY = 3        // Processing received packet
+};
+
+/**
+ * Bus condition reported by capture_data()
+ */
+enum class CaptureEvent : uint8_t {
+    NONE = 0,       // SDA changed while SCL low (data bit)
+    START = 1,      // START or repeated START
+    STOP = 2        // STOP
+};
+
+/**
+ * Cycle counts of one ISR
+ * Measured from ISR entry to exit (the GPIO ISR service dispatch in front of
+ * it is not included); filled only when statistics are enabled.
+ */
+struct IsrCycles {
+    uint32_t count = 0;              // Timed ISR invocations
+    uint32_t min = UINT32_MAX;       // Fastest invocation
+    uint32_t max = 0;                // Slowest invocation
+    uint64_t total = 0;              // Sum over all invocations
+
+    CREALITY_DRYER_CAPTURE_INLINE void add(uint32_t cycles) {
+        count++;
+        total += cycles;
+        if (cycles < min) min = cycles;
+        if (cycles > max) max = cycles;
+    }
+    uint32_t avg() const { return count ? (uint32_t)(total / count) : 0; }
+};
+
+/**
+ * Capture state shared by the ISRs and loop()
+ * One compact structure (placed in DRAM by the component) so the ISRs reach
+ * every field at a fixed address instead of through the instance pointer.
+ * Fields written in interrupt context are volatile.
+ */
+struct CaptureState {
+    static constexpr uint8_t BUFFER_SIZE = 32;                 // Size of receive buffer
+
+    volatile uint8_t buffer[BUFFER_SIZE];                      // I2C packet receive buffer
+    volatile uint8_t byte_num{0};                              // Current byte position in buffer
+    volatile uint8_t bit_num{0};                               // Current bit position in byte
+    volatile uint8_t byte_tmp{0};                              // Temporary byte being assembled
+    volatile uint8_t status{static_cast<uint8_t>(I2CStatus::READY)};  // Current I2C state
+    volatile bool wait_ack{false};                             // Waiting for ACK bit flag
+    volatile uint32_t last_edge{0};                            // Timestamp of last I2C edge (for timeout)
+    bool profile{false};                                       // Record ISR cycle counts
+    IsrCycles scl_cycles;                                      // SCL ISR cost
+    IsrCycles sda_cycles;                                      // SDA ISR cost
+};
+
+/**
+ * CPU cycle stamps to micros() without calling micros() in the ISR
+ * loop() pairs the cycle counter with micros() (set_anchor) far more often
+ * than the counter wraps; a stamp within 2^31 cycles of the latest anchor
+ * converts to its micros() value (to the microsecond). The writer fills the
+ * inactive one of two anchors and then switches, so an ISR on the same core
+ * never converts with a half-written anchor.
+ */
+struct CycleClock {
+    struct Anchor {
+        uint32_t cycles;    // Cycle counter ...
+        uint32_t us;        // ... and micros() read together
+    };
+
+    Anchor anchors[2]{};
+    volatile uint8_t active{0};                                // Anchor the ISR converts with
+    uint32_t cycles_per_us{1};                                 // CPU clock in MHz
+
+    void set_anchor(uint32_t cycles, uint32_t us) {
+        uint8_t next = active ^ 1;
+        anchors[next].cycles = cycles;
+        anchors[next].us = us;
+        std::atomic_signal_fence(std::memory_order_release);  // Anchor stored before the switch
+        active = next;
+    }
+
+    CREALITY_DRYER_CAPTURE_INLINE uint32_t to_us(uint32_t cycles) const {
+        const Anchor &a = anchors[active];
+        return a.us + (int32_t)(cycles - a.cycles) / (int32_t)cycles_per_us;
+    }
+};
+
+/**
+ * SCL rising edge: shift one data bit into the frame (ninth clock = ACK, skipped)
+ * @param read_sda Callable returning the SDA level; only invoked for data bits
+ */
+template<typename ReadSda>
+CREALITY_DRYER_CAPTURE_INLINE void capture_clock(CaptureState &s, ReadSda read_sda) {
+    // Only process if actively receiving data
+    if (s.status != static_cast<uint8_t>(I2CStatus::RECEIVING)) return;
+
+    if (s.wait_ack) {
+        // Skip ACK bit
+        s.wait_ack = false;
+        return;
+    }
+
+    // Read SDA line and shift into byte buffer
+    uint8_t byte = (s.byte_tmp << 1) | read_sda();
+    uint8_t bit = s.bit_num + 1;
+    if (bit < 8) {
+        s.byte_tmp = byte;
+        s.bit_num = bit;
+        return;
+    }
+
+    // Complete byte received (8 bits)
+    uint8_t pos = s.byte_num;
+    if (pos < CaptureState::BUFFER_SIZE) {
+        s.buffer[pos] = byte;
+        s.byte_num = pos + 1;
+    }
+    s.byte_tmp = 0;
+    s.bit_num = 0;
+    s.wait_ack = true;  // Next bit will be ACK
+}
+
+/**
+ * SDA edge: detect START (SDA falls while SCL high) and STOP (SDA rises while SCL high)
+ */
+CREALITY_DRYER_CAPTURE_INLINE CaptureEvent capture_data(CaptureState &s, int scl, int sda) {
+    if (!scl) return CaptureEvent::NONE;
+
+    if (!sda) {
+        // START condition: begin a new frame
+        s.status = static_cast<uint8_t>(I2CStatus::RECEIVING);
+        s.byte_num = 0;
+        s.bit_num = 0;
+        s.byte_tmp = 0;
+        s.wait_ack = false;
+        return CaptureEvent::START;
+    }
+
+    // STOP condition: hand the frame to loop()
+    uint8_t status = s.status;
+    if (status == static_cast<uint8_t>(I2CStatus::RECEIVING) || status == static_cast<uint8_t>(I2CStatus::BUSY)) {
+        s.status = static_cast<uint8_t>(I2CStatus::STOP);
+    }
+    return CaptureEvent::STOP;
+}
+
+/**
+ * Bus idle for longer than the I2C timeout while receiving
+ * A frame without STOP is handed to loop() if it holds any data.
+ */
+inline void capture_timeout(CaptureState &s) {
+    if (s.status == static_cast<uint8_t>(I2CStatus::RECEIVING)) {
+        s.status = static_cast<uint8_t>(s.byte_num > 0 ? I2CStatus::STOP : I2CStatus::READY);
+    }
+}
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
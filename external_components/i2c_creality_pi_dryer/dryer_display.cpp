@@ -0,0 +1,145 @@
+#include "dryer_display.h"
+#include <cstdio>
+#include <cstring>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+// 7-segment bit assignment (derived from the DIGITS table)
+// Bit 0x10 is the decimal point / auxiliary icon next to the digit
+static constexpr uint8_t SEG_A = 0x08;
+static constexpr uint8_t SEG_B = 0x80;
+static constexpr uint8_t SEG_C = 0x20;
+static constexpr uint8_t SEG_D = 0x01;
+static constexpr uint8_t SEG_E = 0x02;
+static constexpr uint8_t SEG_F = 0x04;
+static constexpr uint8_t SEG_G = 0x40;
+static constexpr uint8_t SEG_P = 0x10;
+
+/**
+ * Digit groups of the LCD
+ * Each group is rendered as 7-segment glyphs from consecutive frame bytes
+ */
+struct DigitGroup {
+    const char *label;
+    uint8_t first;   // First frame byte of the group
+    uint8_t count;   // Number of digits
+};
+
+static const DigitGroup DIGIT_GROUPS[] = {
+    {"SV", ActiveProtocol::SV_OFFSET, 2},
+    {"PV", ActiveProtocol::PV_OFFSET, 2},
+    {"RH", ActiveProtocol::RH_OFFSET, 2},
+    {"TIME", ActiveProtocol::HOURS_OFFSET, 6},
+};
+
+/**
+ * Human-readable name of a frame byte (shown in the segment table)
+ * Derived from the protocol descriptor field offsets
+ */
+static const char *byte_name(uint8_t i) {
+    using P = ActiveProtocol;
+    if (i == 0) return "addr";
+    if (i == P::CURSOR_OFFSET) return "cursor";
+    if (i == P::SV_OFFSET || i == P::SV_OFFSET + 1) return "sv";
+    if (i == P::PV_OFFSET || i == P::PV_OFFSET + 1) return "pv";
+    if (i == P::UNITS_OFFSET) return "units";
+    if (i >= P::MATERIAL_OFFSET && i < P::MATERIAL_OFFSET + P::MATERIAL_LENGTH) return "material";
+    if (i == P::RH_OFFSET || i == P::RH_OFFSET + 1) return "rh";
+    if (i == P::HOURS_OFFSET || i == P::HOURS_OFFSET + 1) return "hours";
+    if (i == P::MINUTES_OFFSET || i == P::MINUTES_OFFSET + 1) return "minutes";
+    if (i == P::SECONDS_OFFSET || i == P::SECONDS_OFFSET + 1) return "seconds";
+    return "?";
+}
+
+void DisplayMirror::update(const volatile uint8_t *frame, uint32_t sequence) {
+    LockGuard guard(lock_);
+    for (uint8_t i = 0; i < FRAME_SIZE; i++) {
+        uint8_t changed = segments_[i] ^ frame[i];
+        if (changed) {
+            dirty_[i] |= changed;
+            segments_[i] = frame[i];
+            stale_ = true;
+        }
+    }
+    if (!has_frame_) {
+        has_frame_ = true;
+        stale_ = true;
+    }
+    if (stale_) sequence_ = sequence;
+}
+
+void DisplayMirror::render(std::string &out) {
+    LockGuard guard(lock_);
+    if (stale_) rebuild();
+    out = cache_;
+}
+
+/**
+ * Rebuild text rendering from the segment buffer
+ * Digit groups are drawn as 3-row 7-segment glyphs, followed by a table of
+ * every frame byte with its bits and the segments changed since last render.
+ */
+void DisplayMirror::rebuild() {
+    cache_.clear();
+    char line[96];
+
+    if (!has_frame_) {
+        cache_ = "No frame received\n";
+        stale_ = false;
+        return;
+    }
+
+    uint16_t changed = 0;
+    for (uint8_t i = 0; i < FRAME_SIZE; i++) {
+        for (uint8_t b = dirty_[i]; b; b &= b - 1) changed++;
+    }
+    snprintf(line, sizeof(line), "Creality Pi display (frame #%u, %u segments changed)\n\n",
+             (unsigned)sequence_, changed);
+    cache_ += line;
+
+    // Digit groups: label row followed by three glyph rows
+    for (const auto &group : DIGIT_GROUPS) {
+        std::string rows[3];
+        for (uint8_t d = 0; d < group.count; d++) {
+            uint8_t s = segments_[group.first + d];
+            rows[0] += (s & SEG_A) ? " _ " : "   ";
+            rows[1] += (s & SEG_F) ? '|' : ' ';
+            rows[1] += (s & SEG_G) ? '_' : ' ';
+            rows[1] += (s & SEG_B) ? '|' : ' ';
+            rows[2] += (s & SEG_E) ? '|' : ' ';
+            rows[2] += (s & SEG_D) ? '_' : ' ';
+            rows[2] += (s & SEG_C) ? '|' : ' ';
+            // Decimal point / icon, then separator between digit pairs
+            rows[0] += ' ';
+            rows[1] += ' ';
+            rows[2] += (s & SEG_P) ? '.' : ' ';
+            if (d % 2 == 1 && d + 1 < group.count) {
+                for (auto &row : rows) row += "  ";
+            }
+        }
+        snprintf(line, sizeof(line), "%-5s", group.label);
+        cache_ += line;
+        cache_ += rows[0] + "\n     " + rows[1] + "\n     " + rows[2] + "\n";
+    }
+
+    // Raw segment table (bit 7..0, '*' marks segments changed since last render)
+    cache_ += "\nbyte name     hex  bits      changed\n";
+    for (uint8_t i = 0; i < FRAME_SIZE; i++) {
+        char bits[9], dirty[9];
+        for (uint8_t b = 0; b < 8; b++) {
+            uint8_t mask = 0x80 >> b;
+            bits[b] = (segments_[i] & mask) ? '1' : '0';
+            dirty[b] = (dirty_[i] & mask) ? '*' : '.';
+        }
+        bits[8] = dirty[8] = '\0';
+        snprintf(line, sizeof(line), "%4u %-8s 0x%02X %s  %s\n", i, byte_name(i), segments_[i], bits, dirty);
+        cache_ += line;
+    }
+
+    memset(dirty_, 0, sizeof(dirty_));
+    stale_ = false;
+}
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
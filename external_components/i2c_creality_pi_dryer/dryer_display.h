@@ -0,0 +1,52 @@
+#pragma once
+#include "esphome/core/helpers.h"
+#include "dryer_protocol.h"
+#include <cstdint>
+#include <string>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+/**
+ * Segment-level mirror of the dryer LCD
+ *
+ * Keeps every bit of the last frame (not only the decoded fields) together
+ * with per-segment dirty bits accumulated since the last render. The text
+ * rendering is cached and rebuilt only when at least one segment changed,
+ * so web requests never re-parse frames.
+ *
+ * update() is called from loop(), render() from the web server task; both
+ * take the internal mutex.
+ */
+class DisplayMirror {
+ public:
+  static constexpr uint8_t FRAME_SIZE = ActiveProtocol::FRAME_SIZE;  // Bytes per frame (byte 0 = address)
+
+  /**
+   * Store a new frame and accumulate changed segments
+   * @param frame Pointer to FRAME_SIZE frame bytes
+   * @param sequence Frame sequence number
+   */
+  void update(const volatile uint8_t *frame, uint32_t sequence);
+
+  /**
+   * Copy the current text rendering, rebuilding it only if segments changed
+   * @param out Destination string
+   */
+  void render(std::string &out);
+
+ protected:
+  void rebuild();
+
+  Mutex lock_;
+  uint8_t segments_[FRAME_SIZE]{};   // Last received frame (one bit per segment)
+  uint8_t dirty_[FRAME_SIZE]{};      // Segments changed since last render
+  uint32_t sequence_{0};             // Sequence of last stored frame
+  uint32_t frames_{0};               // Frames stored since last render
+  bool has_frame_{false};            // At least one frame received
+  bool stale_{true};                 // Cached rendering out of date
+  std::string cache_;                // Cached text rendering
+};
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
@@ -0,0 +1,84 @@
+#include "dryer_errors.h"
+#include <cstdio>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+void ErrorHistory::begin_episode(uint8_t code, uint32_t start_ms, uint32_t now_ms) {
+    end_episode(now_ms);
+    LockGuard guard(lock_);
+    ErrorEpisode &ep = episodes_[head_];
+    ep.start_ms = start_ms;
+    ep.end_ms = 0;
+    ep.peak_repeats = 0;
+    ep.code = code;
+    ep.active = true;
+    head_ = (head_ + 1) % HISTORY_SIZE;
+    pending_peak_ = 0;
+    folded_ms_ = now_ms;
+    episode_count_++;
+    if (code < ERROR_CODE_COUNT && code_counts_[code] < UINT16_MAX) code_counts_[code]++;
+}
+
+bool ErrorHistory::end_episode(uint32_t now_ms) {
+    LockGuard guard(lock_);
+    ErrorEpisode &ep = episodes_[(head_ + HISTORY_SIZE - 1) % HISTORY_SIZE];
+    if (!ep.active) return false;
+    fold_repeats();
+    ep.end_ms = now_ms;
+    ep.active = false;
+    return true;
+}
+
+bool ErrorHistory::get_last(ErrorEpisode &out) {
+    LockGuard guard(lock_);
+    if (episode_count_ == 0) return false;
+    fold_repeats();
+    out = episodes_[(head_ + HISTORY_SIZE - 1) % HISTORY_SIZE];
+    return true;
+}
+
+/**
+ * Move the loop-local peak into the active episode
+ */
+void ErrorHistory::fold_repeats() {
+    ErrorEpisode &ep = episodes_[(head_ + HISTORY_SIZE - 1) % HISTORY_SIZE];
+    if (ep.active && pending_peak_ > ep.peak_repeats) ep.peak_repeats = pending_peak_;
+}
+
+/**
+ * Episode as JSON; duration of an active episode runs up to now_ms
+ */
+void ErrorHistory::format(const ErrorEpisode &ep, uint32_t now_ms, char *buf, size_t len) {
+    uint32_t end = ep.active ? now_ms : ep.end_ms;
+    snprintf(buf, len, "{\"code\":\"%s\",\"start_ms\":%u,\"duration_ms\":%u,\"peak_repeats\":%u,\"active\":%s}",
+             error_name(ep.code), (unsigned)ep.start_ms, (unsigned)(end - ep.start_ms),
+             (unsigned)ep.peak_repeats, ep.active ? "true" : "false");
+}
+
+void ErrorHistory::render(std::string &out, uint32_t now_ms) {
+    LockGuard guard(lock_);
+    char line[128];
+
+    snprintf(line, sizeof(line), "{\"episodes\":%u,\"counts\":{", (unsigned)episode_count_);
+    out = line;
+    bool first = true;
+    for (uint8_t code = 0; code < ERROR_CODE_COUNT; code++) {
+        if (code_counts_[code] == 0) continue;
+        snprintf(line, sizeof(line), "%s\"%s\":%u", first ? "" : ",", ERROR_NAMES[code], code_counts_[code]);
+        out += line;
+        first = false;
+    }
+
+    out += "},\"history\":[";
+    uint8_t count = episode_count_ < HISTORY_SIZE ? episode_count_ : HISTORY_SIZE;
+    for (uint8_t i = 0; i < count; i++) {
+        format(episodes_[(head_ + HISTORY_SIZE - 1 - i) % HISTORY_SIZE], now_ms, line, sizeof(line));
+        if (i > 0) out += ",";
+        out += line;
+    }
+    out += "]}";
+}
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
@@ -0,0 +1,108 @@
+#pragma once
+#include "esphome/core/helpers.h"
+#include "dryer_filter.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+/**
+ * Dryer error codes
+ * An error is the glyph index shown after 'E' in the PV field (E0..E9, E10
+ * for an 'E' glyph), so a code is stored as one byte and only mapped to its
+ * name when published.
+ */
+static constexpr uint8_t ERROR_NONE = ErrorFilter::NONE;  // No error ("OK")
+static constexpr uint8_t ERROR_CODE_COUNT = 11;
+static constexpr const char *ERROR_NAMES[ERROR_CODE_COUNT] = {
+    "E0", "E1", "E2", "E3", "E4", "E5", "E6", "E7", "E8", "E9", "E10"
+};
+
+inline const char *error_name(uint8_t code) { return code < ERROR_CODE_COUNT ? ERROR_NAMES[code] : "OK"; }
+
+/**
+ * One confirmed error episode
+ */
+struct ErrorEpisode {
+    uint32_t start_ms;       // millis() of the first frame showing the code
+    uint32_t end_ms;         // millis() of the clear (valid once !active)
+    uint16_t peak_repeats;   // Longest run of consecutive frames showing the code
+    uint8_t code;            // Error code
+    bool active;             // Episode still ongoing
+};
+
+/**
+ * Error history ring
+ *
+ * Keeps the last HISTORY_SIZE error episodes and per-code episode counters
+ * since boot. Updated only on error frames and episode boundaries; names are
+ * formatted only when the history is rendered or an episode ends.
+ *
+ * Updates run in loop(), render() in the web server task; both take the
+ * internal mutex. Error frames only raise a loop-local peak, folded into the
+ * episode under the mutex at most every FOLD_INTERVAL_MS and when the
+ * episode ends, so render() may show a peak up to that old.
+ */
+class ErrorHistory {
+ public:
+  static constexpr uint8_t HISTORY_SIZE = 8;
+  static constexpr uint32_t FOLD_INTERVAL_MS = 1000;  // Max age of the rendered peak_repeats
+
+  /**
+   * Open a new episode (closing a still active one)
+   */
+  void begin_episode(uint8_t code, uint32_t start_ms, uint32_t now_ms);
+
+  /**
+   * Report the current run of consecutive frames showing the active code
+   * Lock-free on most error frames (see FOLD_INTERVAL_MS)
+   */
+  void add_repeats(uint16_t run_length, uint32_t now_ms) {
+    if (run_length <= pending_peak_) return;
+    pending_peak_ = run_length;
+    if (now_ms - folded_ms_ < FOLD_INTERVAL_MS) return;
+    LockGuard guard(lock_);
+    fold_repeats();
+    folded_ms_ = now_ms;
+  }
+
+  /**
+   * Close the active episode
+   * @return false if no episode was active
+   */
+  bool end_episode(uint32_t now_ms);
+
+  /**
+   * Newest episode
+   * @return false if no error occurred since boot
+   */
+  bool get_last(ErrorEpisode &out);
+  uint32_t get_episode_count() const { return episode_count_; }
+  uint16_t get_code_count(uint8_t code) const { return code < ERROR_CODE_COUNT ? code_counts_[code] : 0; }
+
+  /**
+   * Render one episode as JSON
+   */
+  static void format(const ErrorEpisode &ep, uint32_t now_ms, char *buf, size_t len);
+
+  /**
+   * Render counters and history (newest first) as JSON
+   */
+  void render(std::string &out, uint32_t now_ms);
+
+ protected:
+  void fold_repeats();  // Caller holds lock_
+
+  Mutex lock_;
+  ErrorEpisode episodes_[HISTORY_SIZE]{};
+  uint8_t head_{0};                               // Next slot to write
+  uint32_t episode_count_{0};                     // Episodes since boot
+  uint16_t code_counts_[ERROR_CODE_COUNT]{};      // Episodes per code since boot
+  uint16_t pending_peak_{0};                      // Active episode's peak run, not yet folded (loop only)
+  uint32_t folded_ms_{0};                         // millis() of the last fold
+};
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
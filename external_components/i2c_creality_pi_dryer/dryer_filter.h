@@ -0,0 +1,310 @@
+#pragma once
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+// Value filters and their thresholds
+// Kept free of ESPHome dependencies: tools/filter_replay.cpp compiles this
+// header on the host to replay recorded traces through the same code.
+
+/**
+ * Filter thresholds
+ * Defaults are the hand-tuned values; the `filters:` YAML block overrides
+ * them (see tools/filter_tuner.py for picking values from recorded traces).
+ */
+struct FilterConfig {
+    uint8_t set_temp_repeats = 5;            // Consecutive readings to confirm a set temperature
+    uint8_t current_temp_repeats = 5;        // ... a current temperature
+    uint8_t humidity_repeats = 3;            // ... a humidity value
+    uint8_t drying_time_repeats = 2;         // ... a remaining time
+    uint8_t material_repeats = 10;           // ... a material
+    uint8_t cursor_repeats = 3;              // ... a cursor position
+    uint8_t set_temp_max_jump = 5;           // Larger set temperature steps are rejected as noise (without plausibility)
+    uint8_t current_temp_max_jump = 5;       // Larger current temperature steps need jump repeats
+    uint8_t current_temp_jump_repeats = 10;  // Consecutive readings to confirm such a step
+    uint8_t error_confirm_repeats = 3;       // Consecutive error frames to confirm an error
+    uint8_t error_clear_repeats = 10;        // Consecutive normal frames to clear it
+
+    // Plausibility models (see the channel rules below)
+    uint8_t plausibility = 0;                      // Judge readings against elapsed time and cursor (opt-in)
+    uint8_t set_temp_plausible_repeats = 2;        // Readings to confirm a knob step while SV is edited
+    uint8_t current_temp_plausible_repeats = 2;    // ... a one-degree step within the heating/cooling rate
+    uint8_t drying_time_plausible_repeats = 2;     // ... the next countdown value
+    uint8_t implausible_repeats = 30;              // ... an implausible value (it must persist)
+    uint8_t current_temp_max_rate = 10;            // Plausible temperature change, degrees per minute
+    uint8_t drying_time_tolerance = 2;             // Countdown slack in seconds
+};
+
+// Value equality for the filter (names are compared by content)
+template<typename T> inline bool filter_equal(const T &a, const T &b) { return a == b; }
+inline bool filter_equal(const char *a, const char *b) { return strcmp(a, b) == 0; }
+
+/**
+ * Template structure for filtered sensor values
+ * Implements debouncing by requiring multiple consecutive identical readings
+ * before publishing to prevent noise and false readings
+ *
+ * Template parameter T: The data type being filtered (uint8_t, int, const char*, etc.)
+ */
+template<typename T>
+struct FilteredValue {
+    T last_value;           // Last published/confirmed value
+    T candidate;            // Current candidate value being evaluated
+    uint8_t count = 0;      // Number of consecutive times candidate has been seen
+    bool initialized = false; // Whether any value has been published yet
+
+    // Constructor
+    explicit FilteredValue(T initial) : last_value(initial), candidate(initial) {}
+
+    /**
+     * Feed one reading
+     *
+     * @param new_val New value to evaluate
+     * @param repeats Consecutive readings required to confirm it
+     * @return true if a new value was confirmed (caller publishes last_value)
+     */
+    bool accept(const T &new_val, uint8_t repeats) {
+        if (!filter_equal(new_val, candidate)) {
+            // New different value - reset with new candidate
+            candidate = new_val;
+            count = 1;
+        } else {
+            // Same value as candidate - increment count
+            count++;
+        }
+        if (count < repeats) return false;
+        count = 0;  // Reset count after confirming
+        if (initialized && filter_equal(new_val, last_value)) return false;
+        last_value = new_val;
+        initialized = true;
+        return true;
+    }
+
+    /**
+     * Whether a reading is more than max_jump away from the confirmed value
+     */
+    bool is_jump(const T &new_val, uint8_t max_jump) const {
+        return initialized && abs((int)new_val - (int)last_value) > max_jump;
+    }
+
+    /**
+     * Reset filter state
+     * Used when device state changes or connection is lost
+     */
+    void reset() {
+        count = 0;
+        initialized = false;
+    }
+};
+
+/**
+ * Filtered value that remembers when its values first appeared
+ * The plausibility models judge a reading against the time elapsed since the
+ * confirmed value was first shown (not since it was confirmed).
+ */
+template<typename T>
+struct TimedFilteredValue : FilteredValue<T> {
+    uint32_t candidate_ms = 0;  // First frame showing the candidate
+    uint32_t value_ms = 0;      // First frame showing last_value
+
+    explicit TimedFilteredValue(T initial) : FilteredValue<T>(initial) {}
+
+    bool accept(const T &new_val, uint8_t repeats, uint32_t now_ms) {
+        if (this->count == 0 || !filter_equal(new_val, this->candidate)) candidate_ms = now_ms;
+        if (!FilteredValue<T>::accept(new_val, repeats)) return false;
+        value_ms = candidate_ms;
+        return true;
+    }
+
+    // Time since the confirmed value was first shown
+    uint32_t age_ms(uint32_t now_ms) const { return now_ms - value_ms; }
+};
+
+/**
+ * Cursor context of the plausibility models
+ * Remembers when the cursor last stood on each editable field. Edits are
+ * seen slightly after the cursor moved away (confirming an edit moves it),
+ * so a field counts as edited for WINDOW_MS after the cursor left it.
+ */
+struct CursorContext {
+    static constexpr uint32_t WINDOW_MS = 5000;
+
+    struct Seen {
+        bool valid = false;
+        uint32_t ms = 0;
+        bool recent(uint32_t now_ms) const { return valid && now_ms - ms <= WINDOW_MS; }
+    };
+    Seen set_temp;     // Cursor on "SV"
+    Seen drying_time;  // Cursor on "Time"
+    Seen material;     // Cursor on "Material" (material presets change SV and time)
+
+    /**
+     * Raw cursor of one frame (names as returned by the decoder)
+     */
+    void update(const char *cursor, uint32_t now_ms) {
+        Seen *seen = strcmp(cursor, "SV") == 0         ? &set_temp
+                     : strcmp(cursor, "Time") == 0     ? &drying_time
+                     : strcmp(cursor, "Material") == 0 ? &material
+                                                       : nullptr;
+        if (seen == nullptr) return;
+        seen->valid = true;
+        seen->ms = now_ms;
+    }
+
+    bool set_temp_edited(uint32_t now_ms) const { return set_temp.recent(now_ms) || material.recent(now_ms); }
+    bool drying_time_edited(uint32_t now_ms) const { return drying_time.recent(now_ms) || material.recent(now_ms); }
+};
+
+// Channel rules: validity gate, jump handling and repeat count per channel
+// Each returns true when a new value was confirmed.
+//
+// With plausibility enabled, a reading is judged against the confirmed value,
+// the time elapsed since it appeared and the cursor context:
+//   plausible   - what the display would show next (the next countdown
+//                 second, a one-degree temperature step within the rate, a
+//                 knob step while SV is edited): *_plausible_repeats
+//   possible    - a change the context allows (any SV or time while it is
+//                 edited, e.g. material presets; time back to 0 when a run
+//                 is cancelled or ends early): the normal repeats
+//   implausible - a change nothing explains (SV or time jumps without the
+//                 cursor on them): rejected unless it persists for
+//                 implausible_repeats readings
+// Until a value is confirmed (boot, power-on, after an error) every reading
+// is only possible.
+
+inline bool filter_set_temp(TimedFilteredValue<uint8_t> &f, uint8_t sv, const CursorContext &ctx, uint32_t now_ms,
+                            const FilterConfig &cfg) {
+    if (sv >= 225 || sv > 80) return false;
+    if (!cfg.plausibility) {
+        // Reject jumps (likely noise or error)
+        if (f.is_jump(sv, cfg.set_temp_max_jump)) return false;
+        return f.accept(sv, cfg.set_temp_repeats, now_ms);
+    }
+    if (!f.initialized) return f.accept(sv, cfg.set_temp_repeats, now_ms);
+    if (!ctx.set_temp_edited(now_ms)) return f.accept(sv, cfg.implausible_repeats, now_ms);
+    // Edited: one knob step is plausible, larger steps (presets) possible
+    return f.accept(sv, f.is_jump(sv, 1) ? cfg.set_temp_repeats : cfg.set_temp_plausible_repeats, now_ms);
+}
+
+inline bool filter_current_temp(TimedFilteredValue<uint8_t> &f, uint8_t pv, uint32_t now_ms, const FilterConfig &cfg) {
+    if (pv >= 225 || pv > 80) return false;
+    // Jumps are accepted, but only after more repeats
+    if (f.is_jump(pv, cfg.current_temp_max_jump)) return f.accept(pv, cfg.current_temp_jump_repeats, now_ms);
+    // The display walks through every degree: a one-degree step is plausible
+    // once the chamber could have heated or cooled that far since the value
+    // appeared (a step right after the previous one is more likely noise)
+    bool plausible = cfg.plausibility && f.initialized && !f.is_jump(pv, 1) &&
+                     (uint64_t)f.age_ms(now_ms) * cfg.current_temp_max_rate >= 60000;
+    return f.accept(pv, plausible ? cfg.current_temp_plausible_repeats : cfg.current_temp_repeats, now_ms);
+}
+
+inline bool filter_humidity(FilteredValue<uint8_t> &f, uint8_t rh, const FilterConfig &cfg) {
+    if (rh >= 225) return false;
+    return f.accept(rh, cfg.humidity_repeats);
+}
+
+inline bool filter_drying_time(TimedFilteredValue<uint32_t> &f, uint8_t hh, uint8_t mm, uint8_t ss,
+                               const CursorContext &ctx, uint32_t now_ms, const FilterConfig &cfg) {
+    if (hh >= 225 || hh > 48 || mm >= 60 || ss >= 60) return false;
+    uint32_t seconds = (uint32_t)hh * 3600 + mm * 60 + ss;
+    if (!cfg.plausibility || !f.initialized) return f.accept(seconds, cfg.drying_time_repeats, now_ms);
+    
+    // Countdown: below the confirmed value, and at most the elapsed seconds
+    // (plus slack) below it
+    uint32_t elapsed_s = f.age_ms(now_ms) / 1000 + cfg.drying_time_tolerance;
+    uint32_t floor = f.last_value > elapsed_s ? f.last_value - elapsed_s : 0;
+    if (seconds < f.last_value && seconds >= floor) {
+        return f.accept(seconds, cfg.drying_time_plausible_repeats, now_ms);
+    }
+    // Back to idle (0) needs no cursor: the run was cancelled
+    bool possible = seconds == 0 || ctx.drying_time_edited(now_ms);
+    return f.accept(seconds, possible ? cfg.drying_time_repeats : cfg.implausible_repeats, now_ms);
+}
+
+inline bool filter_material(FilteredValue<int> &f, int mat_idx, const FilterConfig &cfg) {
+    if (mat_idx < 0) return false;
+    return f.accept(mat_idx, cfg.material_repeats);
+}
+
+inline bool filter_cursor(FilteredValue<const char *> &f, const char *cursor, const FilterConfig &cfg) {
+    if (strcmp(cursor, "Unknown") == 0) return false;
+    return f.accept(cursor, cfg.cursor_repeats);
+}
+
+/**
+ * Error code debouncing
+ * Implements robust error detection to prevent false error triggers: a code
+ * is confirmed after error_confirm_repeats consecutive error frames and
+ * cleared after error_clear_repeats consecutive normal frames.
+ */
+struct ErrorFilter {
+    static constexpr uint8_t NONE = 0xFF;
+
+    // Events returned by on_error_frame() / on_normal_frame() (bit mask)
+    static constexpr uint8_t NEW_CANDIDATE = 0x01;  // First error frame after normal frames
+    static constexpr uint8_t CONFIRMED = 0x02;      // A new error code was confirmed
+    static constexpr uint8_t CLEARED = 0x04;        // The active error was cleared
+
+    uint8_t code = NONE;                // Confirmed error code (NONE = OK)
+    uint8_t candidate = NONE;           // Candidate error code being evaluated
+    uint8_t error_count = 0;            // Consecutive error readings count
+    uint8_t clear_count = 0;            // Consecutive normal readings count
+    uint16_t run_length = 0;            // Consecutive frames showing the candidate
+    uint32_t candidate_since = 0;       // millis() of the candidate's first frame
+
+    bool active() const { return code != NONE; }  // Whether error is currently active
+
+    /**
+     * Frame showing error code new_code
+     */
+    uint8_t on_error_frame(uint8_t new_code, uint32_t now_ms, const FilterConfig &cfg) {
+        uint8_t events = 0;
+        if (new_code == candidate) {
+            error_count++;
+            if (run_length < UINT16_MAX) run_length++;
+        } else {
+            if (candidate == NONE) events |= NEW_CANDIDATE;
+            candidate = new_code;
+            candidate_since = now_ms;
+            error_count = 1;
+            run_length = 1;
+        }
+        clear_count = 0;
+
+        // If error repeated enough times, confirm it
+        if (error_count >= cfg.error_confirm_repeats) {
+            if (new_code != code) {
+                code = new_code;
+                events |= CONFIRMED;
+            }
+            error_count = 0;
+        }
+        return events;
+    }
+
+    /**
+     * Frame showing a normal value
+     */
+    uint8_t on_normal_frame(const FilterConfig &cfg) {
+        run_length = 0;
+        if (!active()) {
+            // No error, reset counters
+            candidate = NONE;
+            error_count = 0;
+            clear_count = 0;
+            return 0;
+        }
+        error_count = 0;
+        if (++clear_count < cfg.error_clear_repeats) return 0;
+        code = NONE;
+        candidate = NONE;
+        clear_count = 0;
+        return CLEARED;
+    }
+};
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
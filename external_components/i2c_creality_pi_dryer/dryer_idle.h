@@ -0,0 +1,127 @@
+#pragma once
+#include <cstdint>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+// Low-power idle while the dryer is off
+// Free of ESPHome dependencies: the state machine takes the clock as an
+// argument, so it can be driven by a simulated clock on the host.
+// (Not to be confused with DeviceState::IDLE, the dryer being on but not drying.)
+
+/**
+ * Idle/wake state machine
+ *
+ *   ACTIVE  --on_power_off()-->  PENDING  --poll(), enter delay elapsed-->  IDLE
+ *   PENDING --on_power_on()-->   ACTIVE
+ *   IDLE    --on_edge() (ISR)--> WAKING   --poll()-->  PENDING (again idle after
+ *                                                      the delay unless frames follow)
+ *
+ * The enter delay lets pending telemetry/recorder batches age out and be
+ * flushed by loop() before it stops. In IDLE the component's loop and the
+ * SDA interrupt are disabled and only the SCL edge ISR is left; its first
+ * edge moves the state to WAKING and asks for the loop to be re-enabled,
+ * poll() then measures the wake latency. Edges while suspended (IDLE or
+ * WAKING) are not captured.
+ */
+class IdleController {
+ public:
+  enum class State : uint8_t {
+    ACTIVE = 0,   // Dryer on, full capture
+    PENDING = 1,  // Dryer off, waiting for the enter delay
+    IDLE = 2,     // Loop disabled, waiting for a bus edge
+    WAKING = 3    // Edge seen, loop re-enable requested
+  };
+
+  // Returned by poll(): what the component has to do
+  enum class Action : uint8_t {
+    NONE = 0,
+    ENTER_IDLE = 1,  // Disable the loop (and allow light sleep)
+    RESUME = 2       // Loop is running again (restore full capture)
+  };
+
+  static constexpr uint32_t DEFAULT_ENTER_DELAY_MS = 5000;
+
+  void set_enter_delay_ms(uint32_t delay_ms) { enter_delay_ms_ = delay_ms; }
+  uint32_t get_enter_delay_ms() const { return enter_delay_ms_; }
+
+  /**
+   * Dryer detected off (also called at boot, the dryer starts as off)
+   */
+  void on_power_off(uint32_t now_ms) {
+    if (state_ != State::ACTIVE) return;
+    state_ = State::PENDING;
+    since_ms_ = now_ms;
+  }
+
+  /**
+   * Valid frames again: stay awake
+   */
+  void on_power_on() {
+    if (state_ == State::PENDING) state_ = State::ACTIVE;
+  }
+
+  /**
+   * Bus edge, called from the SCL ISR (forced inline into the IRAM handler)
+   * @return true on the first edge while idle (caller re-enables the loop)
+   */
+  inline __attribute__((always_inline)) bool on_edge(uint32_t now_ms) {
+    if (state_ != State::IDLE) return false;
+    state_ = State::WAKING;
+    wake_ms_ = now_ms;
+    return true;
+  }
+
+  /**
+   * Advance the state machine, called from loop()
+   */
+  Action poll(uint32_t now_ms) {
+    switch (state_) {
+      case State::PENDING:
+        if (now_ms - since_ms_ < enter_delay_ms_) return Action::NONE;
+        // IDLE is set before the loop is disabled, so an edge arriving
+        // in between already requests the wake
+        state_ = State::IDLE;
+        entries_++;
+        return Action::ENTER_IDLE;
+      case State::WAKING: {
+        uint32_t latency = now_ms - wake_ms_;
+        last_wake_latency_ms_ = latency;
+        if (latency > max_wake_latency_ms_) max_wake_latency_ms_ = latency;
+        // Back to idle after the delay if the edge did not start frames
+        state_ = State::PENDING;
+        since_ms_ = now_ms;
+        return Action::RESUME;
+      }
+      default:
+        return Action::NONE;
+    }
+  }
+
+  /**
+   * Whether capture is suspended: IDLE, and WAKING until the loop resumes
+   * Checked by the SCL ISR on every edge (forced inline into the IRAM handler)
+   */
+  inline __attribute__((always_inline)) bool is_suspended() const {
+    State state = state_;
+    return state == State::IDLE || state == State::WAKING;
+  }
+
+  State get_state() const { return state_; }
+  bool is_idle() const { return state_ == State::IDLE; }
+  uint32_t get_entries() const { return entries_; }
+  uint32_t get_last_wake_latency_ms() const { return last_wake_latency_ms_; }
+  uint32_t get_max_wake_latency_ms() const { return max_wake_latency_ms_; }
+
+ protected:
+  volatile State state_{State::ACTIVE};     // Shared with the SCL ISR
+  volatile uint32_t wake_ms_{0};            // millis() of the waking edge
+  uint32_t since_ms_{0};                    // Start of the PENDING period
+  uint32_t enter_delay_ms_{DEFAULT_ENTER_DELAY_MS};
+  uint32_t entries_{0};                     // Idle periods since boot
+  uint32_t last_wake_latency_ms_{0};        // Edge to loop, last wake
+  uint32_t max_wake_latency_ms_{0};         // Edge to loop, worst wake
+};
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+// Power-off detection
+// Kept free of ESPHome dependencies: tools/dryer_replay.h applies the same
+// rules to the gaps between recorded frames.
+
+/**
+ * Power-off detector
+ * The display controller sends frames at a steady period while the dryer is
+ * on, so no bus edge for SILENCE_FRAMES frame periods means it has stopped.
+ * The frame period is a peak-hold of the intervals between complete frames
+ * with a slow decay, so gaps between bursts of frames are covered; it is
+ * unknown (0) until the second frame after power-on. DEVICE_TIMEOUT_MS is
+ * the fallback for a bus that still toggles without producing valid frames,
+ * and before the frame period is known.
+ */
+struct PowerDetector {
+    static constexpr uint32_t DEVICE_TIMEOUT_MS = 3000;     // No valid frame for this long means power-off
+    static constexpr uint32_t SILENCE_FRAMES = 4;           // Frame periods of bus silence that mean power-off
+    static constexpr uint32_t MIN_SILENCE_MS = 100;         // Lower bound of the silence timeout
+
+    uint32_t frame_period_ms = 0;       // Recent peak interval between complete frames (0 = unknown)
+
+    /**
+     * Complete frame while the dryer is on
+     * @param interval_ms Time since the previous complete frame
+     */
+    void on_frame(uint32_t interval_ms) {
+        uint32_t decayed = frame_period_ms - (frame_period_ms >> 4);
+        frame_period_ms = interval_ms > decayed ? interval_ms : decayed;
+    }
+
+    /**
+     * Bus silence (ms) after which the dryer is considered off
+     * SILENCE_FRAMES frame periods, clamped to [MIN_SILENCE_MS, DEVICE_TIMEOUT_MS]
+     */
+    uint32_t silence_timeout_ms() const {
+        uint32_t timeout = frame_period_ms * SILENCE_FRAMES;
+        if (timeout < MIN_SILENCE_MS) return MIN_SILENCE_MS;
+        if (timeout > DEVICE_TIMEOUT_MS) return DEVICE_TIMEOUT_MS;
+        return timeout;
+    }
+
+    /**
+     * Whether the dryer is off
+     * @param silence_ms Time since the last bus edge
+     * @param since_frame_ms Time since the last complete frame
+     * @param bus_silent Set when the bus silence (rather than the fallback) decided
+     */
+    bool is_off(uint32_t silence_ms, uint32_t since_frame_ms, bool &bus_silent) const {
+        bus_silent = frame_period_ms != 0 && silence_ms > silence_timeout_ms();
+        return bus_silent || since_frame_ms > DEVICE_TIMEOUT_MS;
+    }
+
+    /**
+     * Dryer went off: the next power-on measures the period anew
+     */
+    void reset() { frame_period_ms = 0; }
+};
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
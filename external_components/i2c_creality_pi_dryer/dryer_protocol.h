@@ -0,0 +1,251 @@
+#pragma once
+#include "esphome/core/defines.h"
+#include <cstdint>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+/**
+ * Cursor mask to name mapping entry
+ */
+struct CursorEntry {
+    uint8_t value;      // Cursor byte value after CURSOR_MASK
+    const char *name;   // Cursor position name
+};
+
+/**
+ * Temperature units byte to name mapping entry
+ */
+struct UnitsEntry {
+    uint8_t value;      // Units byte value
+    const char *name;   // Units name ("C" / "F")
+};
+
+/**
+ * Protocol descriptor: Creality Space Pi Plus
+ *
+ * Captures everything model-specific about the display frame as compile-time
+ * data: bus address, field offsets, 7-segment glyphs and lookup tables.
+ * Another dryer variant is supported by adding a descriptor with the same
+ * members and a matching `model:` option in __init__.py; the decoder is
+ * instantiated on it at compile time, so there is no runtime dispatch.
+ */
+struct SpacePiPlusProtocol {
+    static constexpr const char *NAME = "Space Pi Plus";
+
+    // Frame layout
+    static constexpr uint8_t ADDRESS = 0x7E;          // Display I2C address (8-bit, write)
+    static constexpr uint8_t FRAME_SIZE = 22;         // Bytes per display frame
+    static constexpr uint8_t CURSOR_OFFSET = 2;       // Cursor icons
+    static constexpr uint8_t SV_OFFSET = 3;           // Set temperature (2 digits)
+    static constexpr uint8_t PV_OFFSET = 5;           // Current temperature (2 digits)
+    static constexpr uint8_t UNITS_OFFSET = 7;        // Temperature units
+    static constexpr uint8_t MATERIAL_OFFSET = 8;     // Material name segments
+    static constexpr uint8_t MATERIAL_LENGTH = 6;     // Bytes XOR-ed for material id
+    static constexpr uint8_t RH_OFFSET = 14;          // Relative humidity (2 digits)
+    static constexpr uint8_t HOURS_OFFSET = 16;       // Remaining hours (2 digits)
+    static constexpr uint8_t MINUTES_OFFSET = 18;     // Remaining minutes (2 digits)
+    static constexpr uint8_t SECONDS_OFFSET = 20;     // Remaining seconds (2 digits)
+
+    // 7-segment glyphs
+    // Index 0-9 represents digits 0-9, index 10 represents letter 'E' (for errors)
+    static constexpr uint8_t DIGIT_COUNT = 11;
+    static constexpr uint8_t DIGIT_E = 10;            // Index of the 'E' glyph
+    static constexpr uint8_t DIGIT_MASK = 0xEF;       // Ignore decimal point bit (0x10)
+    static constexpr uint8_t HUNDREDS_BIT = 0x10;     // Decimal point on SV/PV high digit = +100
+    static constexpr uint8_t DIGITS[DIGIT_COUNT] = {
+        0xAF, 0xA0, 0xCB, 0xE9, 0xE4, 0x6D,
+        0x6F, 0xA8, 0xEF, 0xED, 0x4F
+    };
+
+    // Materials, identified by XOR of the material segment bytes
+    // Order of MATERIAL_NAME must match MATERIAL_XOR
+    static constexpr uint8_t MATERIAL_COUNT = 12;
+    static constexpr uint8_t MATERIAL_XOR[MATERIAL_COUNT] = {
+        0x27, 0x37, 0xEB, 0xFD, 0xE3, 0x19,
+        0x83, 0xFE, 0xF3, 0x93, 0x97, 0xE1
+    };
+    static constexpr const char *MATERIAL_NAME[MATERIAL_COUNT] = {
+        "ABS", "ASA", "PETG", "PC", "PA", "PET",
+        "PLA-CF", "PETG-CF", "PA-CF", "PLA", "TPU", "PP"
+    };
+
+    // Cursor icons
+    static constexpr uint8_t CURSOR_MASK = 0x8E;
+    static constexpr uint8_t CURSOR_COUNT = 5;
+    static constexpr CursorEntry CURSORS[CURSOR_COUNT] = {
+        {0x00, "Idle"}, {0x02, "Time"}, {0x04, "Material"}, {0x08, "SV"}, {0x80, "PV"}
+    };
+
+    // Temperature units
+    static constexpr uint8_t UNITS_COUNT = 2;
+    static constexpr UnitsEntry UNITS[UNITS_COUNT] = {
+        {0xE5, "C"}, {0xEA, "F"}
+    };
+};
+
+/**
+ * Current temperature field as seen by error detection
+ */
+enum class PvReading : uint8_t {
+    VALUE = 0,         // Temperature (or an undecodable pair): a normal frame
+    ERROR_CODE = 1,    // 'E' + digit: an error frame
+    UNRECOGNIZED = 2   // Decoded as 'E' only through bit correction: neither
+};
+
+/**
+ * Frame decoder for a protocol descriptor
+ * All methods are static and resolved at compile time for the selected model.
+ */
+template<typename P>
+struct ProtocolDecoder {
+    // Returned for unmapped cursor/units bytes (compare by pointer; an array
+    // has one address in every translation unit, unlike a literal)
+    static constexpr char UNKNOWN[] = "Unknown";
+
+    /**
+     * Calculate Hamming distance between two bytes
+     * Counts number of differing bits (used for error correction)
+     */
+    static uint8_t hamming_distance(uint8_t a, uint8_t b) {
+        uint8_t xor_val = a ^ b;
+        uint8_t count = 0;
+        while (xor_val) {
+            count += xor_val & 1;
+            xor_val >>= 1;
+        }
+        return count;
+    }
+
+    /**
+     * Decode 7-segment display digit pair
+     * Uses lookup table and Hamming distance for error correction
+     *
+     * @param high High byte (tens digit)
+     * @param low Low byte (ones digit)
+     * @param is_temp Whether this is a temperature value (hundreds bit allowed)
+     * @return Decoded numeric value (0-99) or special codes: 255=invalid, 225=error
+     */
+    static uint8_t decode_digit(uint8_t high, uint8_t low, bool is_temp = false) {
+        // Mask decimal point bit for comparison
+        uint8_t high_m = high & P::DIGIT_MASK;
+        uint8_t low_m = low & P::DIGIT_MASK;
+
+        uint8_t dh = 255, dl = 255;  // Initialize as invalid
+
+        // Search for matching digit patterns with error correction
+        for (uint8_t i = 0; i < P::DIGIT_COUNT; i++) {
+            uint8_t digit_m = P::DIGITS[i] & P::DIGIT_MASK;
+
+            // Check high digit (tens place)
+            if (digit_m == high_m) {
+                dh = i * 10;
+            } else if (dh == 255 && hamming_distance(digit_m, high_m) == 1) {
+                // Allow 1-bit error (error correction)
+                dh = i * 10;
+            }
+
+            // Check low digit (ones place)
+            if (digit_m == low_m) {
+                dl = i;
+            } else if (dl == 255 && hamming_distance(digit_m, low_m) == 1) {
+                // Allow 1-bit error (error correction)
+                dl = i;
+            }
+        }
+
+        // Validate decode results
+        if (dh == 255 || dl == 255) return 255;           // Invalid digit
+        if (dh == P::DIGIT_E * 10) return 225;            // Letter 'E' detected (error code)
+        if (is_temp && (high & P::HUNDREDS_BIT)) dh += 100;  // Handle temperatures > 99°C
+
+        return dh + dl;
+    }
+
+    /**
+     * Match a single glyph exactly (decimal point ignored)
+     * @return Glyph index or -1 if no exact match
+     */
+    static int8_t match_glyph(uint8_t val) {
+        for (uint8_t i = 0; i < P::DIGIT_COUNT; i++) {
+            if ((val & P::DIGIT_MASK) == (P::DIGITS[i] & P::DIGIT_MASK)) return i;
+        }
+        return -1;
+    }
+
+    /**
+     * Classify the current temperature field for error detection
+     * The one rule shared by handle_pv_error() and tools/filter_replay.cpp:
+     * decode_digit() reports 'E' after one-bit correction, an error code
+     * additionally needs both glyphs to match exactly.
+     *
+     * @param pv Decoded PV (225 = 'E' in the tens place)
+     * @param high PV high byte
+     * @param low PV low byte
+     * @param code Set to the error digit for ERROR_CODE
+     */
+    static PvReading classify_pv(uint8_t pv, uint8_t high, uint8_t low, uint8_t &code) {
+        if (pv != 225) return PvReading::VALUE;
+        if (match_glyph(high) != P::DIGIT_E) return PvReading::UNRECOGNIZED;
+        int8_t digit = match_glyph(low);
+        if (digit < 0) return PvReading::UNRECOGNIZED;
+        code = digit;
+        return PvReading::ERROR_CODE;
+    }
+
+    /**
+     * Decode material index from XOR checksum of the material segment bytes
+     * @return Material index or -1 if unknown
+     */
+    static int decode_material_idx(const volatile uint8_t *buf) {
+        uint8_t mat_xor = 0;
+        for (uint8_t i = 0; i < P::MATERIAL_LENGTH; i++) mat_xor ^= buf[P::MATERIAL_OFFSET + i];
+
+        // First pass: exact match
+        for (uint8_t i = 0; i < P::MATERIAL_COUNT; i++) {
+            if (mat_xor == P::MATERIAL_XOR[i]) return i;
+        }
+
+        // Second pass: allow 1-bit error (error correction)
+        for (uint8_t i = 0; i < P::MATERIAL_COUNT; i++) {
+            if (hamming_distance(mat_xor, P::MATERIAL_XOR[i]) <= 1) return i;
+        }
+
+        return -1;  // Unknown material
+    }
+
+    /**
+     * Get cursor position name from cursor byte
+     * @return Cursor name or "Unknown"
+     */
+    static const char *get_cursor_name(uint8_t val) {
+        uint8_t cur = val & P::CURSOR_MASK;
+        for (uint8_t i = 0; i < P::CURSOR_COUNT; i++) {
+            if (cur == P::CURSORS[i].value) return P::CURSORS[i].name;
+        }
+        return UNKNOWN;
+    }
+
+    /**
+     * Get temperature units from units byte
+     * @return Units name or "Unknown"
+     */
+    static const char *get_units(uint8_t val) {
+        for (uint8_t i = 0; i < P::UNITS_COUNT; i++) {
+            if (val == P::UNITS[i].value) return P::UNITS[i].name;
+        }
+        return UNKNOWN;
+    }
+};
+
+// Model selected by the `model:` YAML key (USE_CREALITY_DRYER_MODEL_<MODEL> define)
+#if defined(USE_CREALITY_DRYER_MODEL_SPACE_PI_PLUS)
+using ActiveProtocol = SpacePiPlusProtocol;
+#else
+#error "No dryer model selected; set model: in the i2c_creality_pi_dryer configuration"
+#endif
+
+using Decoder = ProtocolDecoder<ActiveProtocol>;
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
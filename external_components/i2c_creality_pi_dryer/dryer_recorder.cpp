@@ -0,0 +1,244 @@
+#include "dryer_recorder.h"
+#include "esphome/core/log.h"
+#include <esp_partition.h>
+#include <cstring>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+static const char *const RECORDER_TAG = "i2c_creality_pi_dryer.recorder";
+
+/**
+ * Whether `size` more bytes fit into the current sector after the written
+ * part, the pending batch and the pending repeat run
+ */
+bool FrameRecorder::fits(size_t size) const {
+    size_t run = repeat_count_ > 0 ? 1 + run_len_ : 0;
+    return sector_offset_ + batch_len_ + run + size <= SECTOR_SIZE;
+}
+
+/**
+ * Locate partition and order the ring by sector sequence
+ * The highest sequence is the newest sector (recording resumes after it), the
+ * lowest the oldest one (start of the ring). Free sectors are not assumed to
+ * be at the end: a reset between erase and header write leaves one after the
+ * newest sector even once the ring has wrapped.
+ */
+bool FrameRecorder::begin() {
+    LockGuard guard(lock_);
+    partition_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label_);
+    if (partition_ == nullptr) {
+        ESP_LOGE(RECORDER_TAG, "Partition '%s' not found, recorder disabled", label_);
+        return false;
+    }
+
+    sector_count_ = partition_->size / SECTOR_SIZE;
+    if (sector_count_ < 2) {
+        ESP_LOGE(RECORDER_TAG, "Partition '%s' too small (%u bytes)", label_, (unsigned)partition_->size);
+        partition_ = nullptr;
+        return false;
+    }
+
+    // Scan sector headers for the highest and the lowest sequence number
+    uint32_t used = 0;
+    uint32_t oldest_seq = 0;
+    sector_ = sector_count_ - 1;  // First start_sector() then begins at sector 0
+    oldest_ = 0;
+    for (uint32_t i = 0; i < sector_count_; i++) {
+        uint32_t header[2];
+        if (esp_partition_read(partition_, i * SECTOR_SIZE, header, sizeof(header)) != ESP_OK) continue;
+        if (header[0] != SECTOR_MAGIC) continue;
+        used++;
+        if (used == 1 || header[1] > sector_seq_) {
+            sector_seq_ = header[1];
+            sector_ = i;
+        }
+        if (used == 1 || header[1] < oldest_seq) {
+            oldest_seq = header[1];
+            oldest_ = i;
+        }
+    }
+    has_data_ = used > 0;
+    sector_offset_ = 0;  // No sector open until the first frame arrives
+
+    ESP_LOGI(RECORDER_TAG, "Recording to '%s': %u sectors, %u in use",
+             label_, (unsigned)sector_count_, (unsigned)used);
+    return true;
+}
+
+/**
+ * Unsigned LEB128
+ * @return Encoded length (at most 5 bytes)
+ */
+static size_t encode_varint(uint32_t val, uint8_t *out) {
+    size_t len = 0;
+    while (val >= 0x80) {
+        out[len++] = (val & 0x7F) | 0x80;
+        val >>= 7;
+    }
+    out[len++] = val;
+    return len;
+}
+
+void FrameRecorder::put_varint(uint32_t val) {
+    batch_len_ += encode_varint(val, batch_ + batch_len_);
+}
+
+/**
+ * Erase the next sector of the ring and write its header
+ * The next record is forced to be a keyframe so the sector decodes on its own
+ */
+void FrameRecorder::start_sector(uint32_t now_ms) {
+    LockGuard guard(lock_);
+    uint32_t next = (sector_ + 1) % sector_count_;
+    if (!has_data_) {
+        oldest_ = next;
+    } else if (next == oldest_) {
+        oldest_ = (oldest_ + 1) % sector_count_;  // Overwriting the oldest sector
+    }
+    sector_ = next;
+    sector_seq_++;
+
+    size_t base = sector_ * SECTOR_SIZE;
+    if (esp_partition_erase_range(partition_, base, SECTOR_SIZE) != ESP_OK) {
+        ESP_LOGW(RECORDER_TAG, "Erase of sector %u failed", (unsigned)sector_);
+    }
+    uint32_t header[3] = {SECTOR_MAGIC, sector_seq_, now_ms};
+    if (esp_partition_write(partition_, base, header, sizeof(header)) != ESP_OK) {
+        ESP_LOGW(RECORDER_TAG, "Header write of sector %u failed", (unsigned)sector_);
+    }
+    sector_offset_ = SECTOR_HEADER_SIZE;
+    has_data_ = true;
+    need_keyframe_ = true;
+    prev_ms_ = now_ms;
+}
+
+/**
+ * Move a pending run of identical frames into the batch
+ * Every repeat was only accepted while the run fit into the current sector,
+ * so a run never has to move to a new sector.
+ */
+void FrameRecorder::end_repeat_run() {
+    if (repeat_count_ == 0) return;
+    if (batch_len_ + 1 + run_len_ > BATCH_SIZE) flush();
+    if (batch_len_ == 0) batch_start_ms_ = run_start_ms_;
+    put(0x80 | repeat_count_);
+    memcpy(batch_ + batch_len_, run_, run_len_);
+    batch_len_ += run_len_;
+    run_len_ = 0;
+    repeat_count_ = 0;
+}
+
+/**
+ * Encode one frame as a repeat, delta or keyframe record
+ */
+void FrameRecorder::add_frame(const volatile uint8_t *frame, uint32_t now_ms) {
+    if (!is_enabled()) return;
+
+    uint8_t current[FRAME_SIZE];
+    for (uint8_t i = 0; i < FRAME_SIZE; i++) current[i] = frame[i];
+
+    // Identical frame: extend the repeat run by its timestamp
+    if (!need_keyframe_ && sector_offset_ != 0 && memcmp(current, prev_frame_, FRAME_SIZE) == 0) {
+        uint8_t dt[5];
+        size_t size = encode_varint(now_ms - prev_ms_, dt);
+        if (repeat_count_ == MAX_REPEAT || run_len_ + size > RUN_SIZE) end_repeat_run();
+        // A new run also needs its tag byte
+        if (fits(size + (repeat_count_ == 0 ? 1 : 0))) {
+            if (repeat_count_ == 0) run_start_ms_ = now_ms;
+            memcpy(run_ + run_len_, dt, size);
+            run_len_ += size;
+            repeat_count_++;
+            prev_ms_ = now_ms;
+            return;
+        }
+        // Sector full: the frame opens the next sector as a keyframe
+    }
+
+    // New sector if this record does not fit after the pending repeat run
+    if (sector_offset_ == 0 || !fits(MAX_RECORD_SIZE)) {
+        end_repeat_run();
+        flush();
+        start_sector(now_ms);
+    }
+    end_repeat_run();
+    if (batch_len_ + MAX_RECORD_SIZE > BATCH_SIZE) flush();
+    if (batch_len_ == 0) batch_start_ms_ = now_ms;
+
+    uint32_t dt = now_ms - prev_ms_;
+    if (need_keyframe_) {
+        put(0x00);
+        put_varint(dt);
+        for (uint8_t i = 0; i < FRAME_SIZE; i++) put(current[i]);
+        need_keyframe_ = false;
+    } else {
+        uint32_t mask = 0;
+        for (uint8_t i = 0; i < FRAME_SIZE; i++) {
+            if (current[i] != prev_frame_[i]) mask |= (1UL << i);
+        }
+        put(0x01);
+        put_varint(dt);
+        put(mask & 0xFF);
+        put((mask >> 8) & 0xFF);
+        put((mask >> 16) & 0xFF);
+        for (uint8_t i = 0; i < FRAME_SIZE; i++) {
+            if (mask & (1UL << i)) put(current[i]);
+        }
+    }
+
+    memcpy(prev_frame_, current, FRAME_SIZE);
+    prev_ms_ = now_ms;
+}
+
+/**
+ * Write pending batch if its oldest record has waited FLUSH_INTERVAL_MS
+ * A pending repeat run counts from its first repeat, so an unchanged display
+ * is persisted as well.
+ */
+void FrameRecorder::flush_if_due(uint32_t now_ms) {
+    if (repeat_count_ > 0 && (now_ms - run_start_ms_) >= FLUSH_INTERVAL_MS) end_repeat_run();
+    if (batch_len_ > 0 && (now_ms - batch_start_ms_) >= FLUSH_INTERVAL_MS) flush();
+}
+
+/**
+ * Append the RAM batch to the current sector (single flash write)
+ */
+void FrameRecorder::flush() {
+    if (batch_len_ == 0 || sector_offset_ == 0) return;
+    LockGuard guard(lock_);
+    size_t addr = sector_ * SECTOR_SIZE + sector_offset_;
+    if (esp_partition_write(partition_, addr, batch_, batch_len_) != ESP_OK) {
+        ESP_LOGW(RECORDER_TAG, "Write of %u bytes at 0x%X failed", (unsigned)batch_len_, (unsigned)addr);
+    }
+    sector_offset_ += batch_len_;
+    batch_len_ = 0;
+}
+
+/**
+ * Sectors from the oldest to the newest one in ring order
+ */
+uint32_t FrameRecorder::used_sectors() const {
+    if (!is_enabled() || !has_data_) return 0;
+    return (sector_ + sector_count_ - oldest_) % sector_count_ + 1;
+}
+
+uint32_t FrameRecorder::get_used_sectors() {
+    LockGuard guard(lock_);
+    return used_sectors();
+}
+
+/**
+ * Read a sector in ring order (oldest first)
+ * The sector currently being written is returned up to its last flushed batch;
+ * a sector inside the ring whose header could not be read is returned as it
+ * is and skipped by the decoder.
+ */
+bool FrameRecorder::read_sector(uint32_t index, uint8_t *out) {
+    LockGuard guard(lock_);
+    if (index >= used_sectors()) return false;
+    uint32_t physical = (oldest_ + index) % sector_count_;
+    return esp_partition_read(partition_, physical * SECTOR_SIZE, out, SECTOR_SIZE) == ESP_OK;
+}
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
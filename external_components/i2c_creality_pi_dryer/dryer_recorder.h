@@ -0,0 +1,127 @@
+#pragma once
+#include "esphome/core/helpers.h"
+#include "dryer_protocol.h"
+#include <cstdint>
+#include <cstddef>
+
+struct esp_partition_t;
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+/**
+ * Raw frame recorder with a compressed flash ring
+ *
+ * Frames are delta/RLE-encoded into a RAM batch and appended to a dedicated
+ * data partition in batches, sector by sector. Sectors are used round-robin,
+ * so every sector is erased equally often (wear levelling) and the oldest
+ * sector is overwritten when the partition is full.
+ *
+ * Sector layout:
+ *   uint32 magic        'CPR2' (0x32525043)
+ *   uint32 sequence     Monotonic sector sequence (orders the ring)
+ *   uint32 start_ms     millis() of the first frame in the sector
+ *   records...          until 0xFF (erased flash)
+ *
+ * Records (tag byte first, varints are unsigned LEB128, every dt_ms is
+ * relative to the frame before):
+ *   0x00              keyframe: varint dt_ms, FRAME_SIZE bytes
+ *   0x01              delta: varint dt_ms, 3-byte mask (LE), changed bytes
+ *   0x80 | n          n (1..126) repeats of the previous frame,
+ *                     n varints dt_ms (one per repeat)
+ *
+ * Frames and timestamps replay exactly (a repeat costs one byte at frame
+ * periods below 128 ms). Each sector starts with a keyframe so sectors
+ * decode independently (see tools/recording_tool.py). Sectors of the first
+ * format ('CPRF', interpolated repeat timestamps) are treated as free.
+ *
+ * get_used_sectors() and read_sector() serve the web task while loop()
+ * records: lock_ covers the ring indices and every flash access, so a sector
+ * is never read while it is erased or half written. The ring can still move
+ * on between two read_sector() calls.
+ */
+class FrameRecorder {
+ public:
+  static constexpr uint32_t SECTOR_MAGIC = 0x32525043;     // 'CPR2'
+  static constexpr size_t SECTOR_SIZE = 4096;              // Flash erase unit
+  static constexpr size_t SECTOR_HEADER_SIZE = 12;
+  static constexpr size_t BATCH_SIZE = 256;                // RAM batch before a flash write
+  static constexpr uint32_t FLUSH_INTERVAL_MS = 30000;     // Max age of a pending batch
+  static constexpr uint8_t FRAME_SIZE = ActiveProtocol::FRAME_SIZE;
+  static constexpr uint8_t MAX_REPEAT = 126;               // 0xFF is reserved for erased flash
+  static constexpr size_t RUN_SIZE = 128;                  // Encoded timestamps of a pending repeat run
+  static constexpr size_t MAX_RECORD_SIZE = 1 + 5 + FRAME_SIZE;  // Keyframe worst case
+  static_assert(FRAME_SIZE <= 24, "Delta mask is 3 bytes wide");
+
+  void set_partition_label(const char *label) { label_ = label; }
+
+  /**
+   * Locate the partition, order the ring by sector sequence and resume after
+   * the newest sector
+   * @return false if the partition is missing (recorder stays disabled)
+   */
+  bool begin();
+
+  /**
+   * Record one frame
+   * @param frame Pointer to FRAME_SIZE frame bytes
+   * @param now_ms Frame timestamp (millis())
+   */
+  void add_frame(const volatile uint8_t *frame, uint32_t now_ms);
+
+  /**
+   * Write pending batch (and repeat run) if it is older than FLUSH_INTERVAL_MS
+   */
+  void flush_if_due(uint32_t now_ms);
+
+  bool is_enabled() const { return partition_ != nullptr; }
+  const char *get_partition_label() const { return label_; }
+  uint32_t get_sector_count() const { return sector_count_; }
+
+  /**
+   * Number of sectors holding data, oldest first in read_sector() order
+   */
+  uint32_t get_used_sectors();
+
+  /**
+   * Read the index-th oldest sector (0 = oldest)
+   * @param index Ring position
+   * @param out Buffer of SECTOR_SIZE bytes
+   * @return false if index is out of range or the read failed
+   */
+  bool read_sector(uint32_t index, uint8_t *out);
+
+ protected:
+  void flush();
+  void start_sector(uint32_t now_ms);
+  void put(uint8_t val) { batch_[batch_len_++] = val; }
+  void put_varint(uint32_t val);
+  void end_repeat_run();
+  bool fits(size_t size) const;
+  uint32_t used_sectors() const;  // Caller holds lock_
+
+  Mutex lock_;
+  const char *label_{"dryer_rec"};
+  const esp_partition_t *partition_{nullptr};
+  uint32_t sector_count_{0};          // Sectors in the partition
+  uint32_t sector_{0};                // Current (newest) sector index
+  uint32_t oldest_{0};                // Oldest sector index (ring start)
+  uint32_t sector_seq_{0};            // Sequence number of the current sector
+  size_t sector_offset_{0};           // Write offset within the current sector (flash)
+  bool has_data_{false};              // At least one sector holds data
+
+  uint8_t batch_[BATCH_SIZE];         // Encoded records not yet written
+  size_t batch_len_{0};
+  uint32_t batch_start_ms_{0};        // Time the oldest pending record was added
+
+  uint8_t prev_frame_[FRAME_SIZE];    // Delta reference
+  uint32_t prev_ms_{0};               // Timestamp of the previous frame
+  bool need_keyframe_{true};          // Next record must be a keyframe
+  uint8_t run_[RUN_SIZE];             // Timestamps (varint dt_ms) of the pending repeat run
+  size_t run_len_{0};
+  uint8_t repeat_count_{0};           // Pending repeats of prev_frame_
+  uint32_t run_start_ms_{0};          // Time of the first pending repeat
+};
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
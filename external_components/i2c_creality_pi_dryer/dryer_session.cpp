@@ -0,0 +1,148 @@
+#include "dryer_session.h"
+#include "i2c_creality_pi_dryer.h"
+#include "esphome/core/log.h"
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+static const char *const SESSION_TAG = "i2c_creality_pi_dryer.session";
+static const char *const OUTCOME_NAMES[] = {"completed", "aborted", "power_off"};
+
+// Unix time before which the clock is considered unsynchronized (2020-01-01)
+static constexpr time_t MIN_VALID_TIME = 1577836800;
+
+void SessionTracker::begin() {
+    uint32_t base = fnv1_hash("i2c_creality_pi_dryer_session");
+    for (uint8_t i = 0; i < HISTORY_SIZE; i++) {
+        prefs_[i] = global_preferences->make_preference<SessionRecord>(base + i, true);
+        if (!prefs_[i].load(&records_[i])) records_[i] = SessionRecord{};
+        if (records_[i].number > last_number_) last_number_ = records_[i].number;
+    }
+    ESP_LOGD(SESSION_TAG, "Loaded session history, last session #%u", (unsigned)last_number_);
+}
+
+/**
+ * Follow session boundaries and collect run values from a change set
+ */
+bool SessionTracker::update(const DryerSnapshot &snap, uint32_t now_ms) {
+    bool drying = strcmp(snap.status, "Drying") == 0;
+
+    if (!active_) {
+        if (!drying) return false;
+        active_ = true;
+        start_ms_ = now_ms;
+        remaining_s_ = UINT32_MAX;
+        current_ = SessionRecord{};
+        current_.material = -1;
+        current_.set_temp = 255;
+        current_.initial_rh = 255;
+        current_.final_rh = 255;
+        time_t now = ::time(nullptr);
+        current_.start_time = now >= MIN_VALID_TIME ? (uint32_t)now : 0;
+        ESP_LOGI(SESSION_TAG, "Drying session started");
+    }
+
+    // Collect run values (last known value wins, except initial humidity)
+    if (drying && snap.drying_time != UINT32_MAX) remaining_s_ = snap.drying_time;
+    if (snap.set_temp != 255) current_.set_temp = snap.set_temp;
+    if (snap.humidity != 255) {
+        if (current_.initial_rh == 255) current_.initial_rh = snap.humidity;
+        current_.final_rh = snap.humidity;
+    }
+    if (snap.material != nullptr) {
+        for (uint8_t i = 0; i < ActiveProtocol::MATERIAL_COUNT; i++) {
+            if (strcmp(snap.material, ActiveProtocol::MATERIAL_NAME[i]) == 0) current_.material = i;
+        }
+    }
+    if (snap.error != nullptr) {
+        for (uint8_t code = 0; code < ERROR_CODE_COUNT; code++) {
+            if (strcmp(snap.error, ERROR_NAMES[code]) == 0) current_.error_mask |= 1 << code;
+        }
+    }
+
+    if (strcmp(snap.status, "Idle") == 0) {
+        finish(remaining_s_ <= COMPLETE_MARGIN_S ? SessionOutcome::COMPLETED : SessionOutcome::ABORTED, now_ms);
+        return true;
+    }
+    if (strcmp(snap.status, "Off") == 0) {
+        finish(SessionOutcome::POWER_OFF, now_ms);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Store the finished session in the next ring slot
+ * save() only queues the record; ESPHome commits it to NVS on its next sync
+ */
+void SessionTracker::finish(SessionOutcome outcome, uint32_t now_ms) {
+    active_ = false;
+    current_.duration_s = (now_ms - start_ms_) / 1000;
+    current_.outcome = static_cast<uint8_t>(outcome);
+
+    LockGuard guard(lock_);
+    current_.number = ++last_number_;
+    uint8_t slot = (current_.number - 1) % HISTORY_SIZE;
+    records_[slot] = current_;
+    prefs_[slot].save(&records_[slot]);
+    ESP_LOGI(SESSION_TAG, "Drying session #%u %s after %u s", (unsigned)current_.number,
+             OUTCOME_NAMES[current_.outcome], (unsigned)current_.duration_s);
+}
+
+bool SessionTracker::get_last(SessionRecord &out) {
+    LockGuard guard(lock_);
+    if (last_number_ == 0) return false;
+    out = records_[(last_number_ - 1) % HISTORY_SIZE];
+    return true;
+}
+
+void SessionTracker::format(const SessionRecord &rec, char *buf, size_t len) {
+    // Unknown values become JSON null
+    char set_temp[5], initial_rh[5], final_rh[5], material[12], errors[72];
+    auto fmt_u8 = [](char *out, size_t n, uint8_t val) {
+        if (val == 255) snprintf(out, n, "null");
+        else snprintf(out, n, "%u", val);
+    };
+    fmt_u8(set_temp, sizeof(set_temp), rec.set_temp);
+    fmt_u8(initial_rh, sizeof(initial_rh), rec.initial_rh);
+    fmt_u8(final_rh, sizeof(final_rh), rec.final_rh);
+    if (rec.material >= 0 && rec.material < ActiveProtocol::MATERIAL_COUNT) {
+        snprintf(material, sizeof(material), "\"%s\"", ActiveProtocol::MATERIAL_NAME[rec.material]);
+    } else {
+        snprintf(material, sizeof(material), "null");
+    }
+    size_t pos = snprintf(errors, sizeof(errors), "[");
+    for (uint8_t code = 0; code < ERROR_CODE_COUNT; code++) {
+        if (rec.error_mask & (1 << code)) {
+            pos += snprintf(errors + pos, sizeof(errors) - pos, "%s\"%s\"", pos > 1 ? "," : "", ERROR_NAMES[code]);
+        }
+    }
+    snprintf(errors + pos, sizeof(errors) - pos, "]");
+
+    snprintf(buf, len,
+             "{\"number\":%u,\"start\":%u,\"duration_s\":%u,\"material\":%s,\"set_temp\":%s,"
+             "\"initial_humidity\":%s,\"final_humidity\":%s,\"errors\":%s,\"outcome\":\"%s\"}",
+             (unsigned)rec.number, (unsigned)rec.start_time, (unsigned)rec.duration_s, material, set_temp,
+             initial_rh, final_rh, errors, OUTCOME_NAMES[rec.outcome < 3 ? rec.outcome : 1]);
+}
+
+void SessionTracker::render(std::string &out) {
+    LockGuard guard(lock_);
+    char record[256];
+    out = "[";
+    uint32_t count = last_number_ < HISTORY_SIZE ? last_number_ : HISTORY_SIZE;
+    for (uint32_t i = 0; i < count; i++) {
+        const SessionRecord &rec = records_[(last_number_ - 1 - i) % HISTORY_SIZE];
+        if (rec.number == 0) continue;
+        format(rec, record, sizeof(record));
+        if (out.size() > 1) out += ",";
+        out += record;
+    }
+    out += "]";
+}
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
@@ -0,0 +1,104 @@
+#pragma once
+#include "esphome/core/helpers.h"
+#include "esphome/core/preferences.h"
+#include "dryer_protocol.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+struct DryerSnapshot;
+
+/**
+ * How a drying session ended
+ */
+enum class SessionOutcome : uint8_t {
+    COMPLETED = 0,  // Timer ran out
+    ABORTED = 1,    // Stopped with time remaining
+    POWER_OFF = 2   // Dryer switched off (or bus lost) during the run
+};
+
+/**
+ * Persisted drying session record (20 bytes)
+ */
+struct SessionRecord {
+    uint32_t number;         // Monotonic session number (0 = empty slot)
+    uint32_t start_time;     // Unix time of the start (0 = clock not synchronized)
+    uint32_t duration_s;     // Run length in seconds
+    uint16_t error_mask;     // Bit n set = error En shown during the run
+    int8_t material;         // Material index in the protocol descriptor (-1 = unknown)
+    uint8_t set_temp;        // Set temperature (255 = unknown)
+    uint8_t initial_rh;      // First humidity reading of the run (255 = unknown)
+    uint8_t final_rh;        // Last humidity reading of the run (255 = unknown)
+    uint8_t outcome;         // SessionOutcome
+    uint8_t reserved;
+};
+
+/**
+ * Drying session tracker
+ *
+ * Follows the aggregated snapshot: a session starts when the status becomes
+ * "Drying" and ends on "Idle" (completed if the timer had run out, aborted
+ * otherwise) or "Off". The running session only lives in RAM; one record is
+ * written per finished session into a ring of NVS preferences, so there are
+ * no flash writes during a run and ESPHome batches the commit with its
+ * regular preference sync.
+ *
+ * update() runs in loop(), render() in the web server task; the record ring
+ * is guarded by the internal mutex.
+ */
+class SessionTracker {
+ public:
+  static constexpr uint8_t HISTORY_SIZE = 16;           // Records kept in NVS
+  static constexpr uint32_t COMPLETE_MARGIN_S = 120;    // Remaining time still counted as completed
+
+  /**
+   * Load stored records from NVS
+   */
+  void begin();
+
+  /**
+   * Follow one change set of the aggregated snapshot
+   * @param snap Snapshot after the change set
+   * @param now_ms Current millis()
+   * @return true if a session was finished and stored
+   */
+  bool update(const DryerSnapshot &snap, uint32_t now_ms);
+
+  /**
+   * Newest stored record
+   * @return false if no session was recorded yet
+   */
+  bool get_last(SessionRecord &out);
+  uint32_t get_count() const { return last_number_; }
+
+  /**
+   * Render one record as JSON
+   */
+  static void format(const SessionRecord &rec, char *buf, size_t len);
+
+  /**
+   * Render the history as a JSON array (newest first)
+   * @param out Destination string
+   */
+  void render(std::string &out);
+
+ protected:
+  void finish(SessionOutcome outcome, uint32_t now_ms);
+
+  Mutex lock_;
+  ESPPreferenceObject prefs_[HISTORY_SIZE];
+  SessionRecord records_[HISTORY_SIZE]{};
+  uint32_t last_number_{0};          // Number of the newest stored record
+
+  // Running session (RAM only)
+  bool active_{false};
+  SessionRecord current_{};
+  uint32_t start_ms_{0};
+  uint32_t remaining_s_{UINT32_MAX}; // Last remaining time seen while drying
+};
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
@@ -0,0 +1,121 @@
+#include "esphome/core/defines.h"
+#ifdef USE_CREALITY_DRYER_TELEMETRY
+#include "dryer_telemetry.h"
+#include <lwip/sockets.h>
+#include <lwip/inet.h>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+/**
+ * Configure telemetry destination
+ * The socket itself is opened lazily on the first flush, after WiFi is up
+ */
+void DryerTelemetry::configure(const char *host, uint16_t port, uint8_t batch_size) {
+    addr_ = inet_addr(host);
+    port_ = port;
+    batch_size_ = batch_size;
+    enabled_ = true;
+}
+
+void DryerTelemetry::put_u16(uint16_t val) {
+    datagram_[length_++] = val & 0xFF;
+    datagram_[length_++] = val >> 8;
+}
+
+void DryerTelemetry::put_u32(uint32_t val) {
+    for (uint8_t i = 0; i < 4; i++) {
+        datagram_[length_++] = (val >> (8 * i)) & 0xFF;
+    }
+}
+
+/**
+ * Append a frame record to the current batch
+ * First record of a datagram is a full keyframe, the rest carry only the
+ * bytes that differ from the previous frame.
+ */
+void DryerTelemetry::add_frame(const volatile uint8_t *frame, uint32_t sequence, uint32_t now_ms, uint8_t flags) {
+    if (!enabled_) return;
+
+    // Flush first if a worst-case record would not fit
+    if (count_ > 0 && length_ + RECORD_HEADER_SIZE + FRAME_SIZE > DATAGRAM_SIZE) {
+        flush();
+    }
+
+    bool keyframe = (count_ == 0);
+    if (keyframe) {
+        // Start new datagram with header (count patched in flush())
+        length_ = 0;
+        put_u32(TELEMETRY_MAGIC);
+        datagram_[length_++] = TELEMETRY_VERSION;
+        datagram_[length_++] = 0;
+        put_u16(0);
+        put_u32(sequence);
+        put_u32(now_ms);
+        batch_start_ms_ = now_ms;
+    }
+
+    // Changed-byte mask against previous frame
+    uint32_t mask = 0;
+    for (uint8_t i = 0; i < FRAME_SIZE; i++) {
+        if (keyframe || frame[i] != prev_frame_[i]) mask |= (1UL << i);
+    }
+
+    uint32_t dt = keyframe ? 0 : now_ms - prev_ms_;
+    datagram_[length_++] = flags;
+    datagram_[length_++] = keyframe ? 0 : (uint8_t)(sequence - prev_seq_);
+    put_u16(dt > 0xFFFF ? 0xFFFF : (uint16_t)dt);
+    put_u32(mask);
+    for (uint8_t i = 0; i < FRAME_SIZE; i++) {
+        if (mask & (1UL << i)) datagram_[length_++] = frame[i];
+        prev_frame_[i] = frame[i];
+    }
+
+    prev_seq_ = sequence;
+    prev_ms_ = now_ms;
+    count_++;
+
+    if (count_ >= batch_size_) flush();
+}
+
+/**
+ * Flush pending batch if its first record is older than FLUSH_INTERVAL_MS
+ */
+void DryerTelemetry::flush_if_due(uint32_t now_ms) {
+    if (count_ > 0 && (now_ms - batch_start_ms_) >= FLUSH_INTERVAL_MS) flush();
+}
+
+/**
+ * Send assembled datagram
+ * Send failures (e.g. WiFi down) drop the batch; telemetry is best-effort
+ */
+void DryerTelemetry::flush() {
+    if (count_ == 0) return;
+    datagram_[5] = count_;
+
+    if (socket_ < 0) {
+        socket_ = lwip_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    }
+
+    if (socket_ >= 0) {
+        struct sockaddr_in dest = {};
+        dest.sin_family = AF_INET;
+        dest.sin_port = htons(port_);
+        dest.sin_addr.s_addr = addr_;
+        if (lwip_sendto(socket_, datagram_, length_, 0, (struct sockaddr *)&dest, sizeof(dest)) < 0) {
+            send_errors_++;
+        } else {
+            datagrams_sent_++;
+        }
+    } else {
+        send_errors_++;
+    }
+
+    count_ = 0;
+    length_ = 0;
+}
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
+
+#endif  // USE_CREALITY_DRYER_TELEMETRY
@@ -0,0 +1,95 @@
+#pragma once
+#include "dryer_protocol.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+/**
+ * Binary UDP telemetry stream of raw dryer frames
+ *
+ * Frames are batched into datagrams and delta-encoded against the previous
+ * frame, so a steady display costs only a few bytes per frame.
+ *
+ * Datagram layout (little-endian):
+ *   Header (16 bytes):
+ *     uint32 magic        'CPDT' (0x54445043)
+ *     uint8  version      TELEMETRY_VERSION
+ *     uint8  count        Number of records in this datagram
+ *     uint16 reserved     0
+ *     uint32 base_seq     Frame sequence number of the first record
+ *     uint32 base_ms      millis() timestamp of the first record
+ *   Record (8 bytes + changed bytes):
+ *     uint8  flags        Bit 0: error active, bits 1-3: DeviceState
+ *     uint8  seq_delta    Sequence delta to the previous record (0 for the first)
+ *     uint16 dt_ms        Time delta to the previous record (saturated at 65535)
+ *     uint32 mask         Bit n set = frame byte n follows (bits 0..FRAME_SIZE-1)
+ *     uint8  bytes[]      Changed frame bytes in ascending index order
+ *
+ * The first record of each datagram carries all FRAME_SIZE bytes, so every
+ * datagram can be decoded on its own (see tools/telemetry_receiver.py).
+ */
+class DryerTelemetry {
+ public:
+  static constexpr uint32_t TELEMETRY_MAGIC = 0x54445043;  // 'CPDT'
+  static constexpr uint8_t TELEMETRY_VERSION = 1;
+  static constexpr uint8_t FRAME_SIZE = ActiveProtocol::FRAME_SIZE;  // Bytes per dryer frame
+  static_assert(FRAME_SIZE <= 32, "Changed-byte mask is 32 bits wide");
+  static constexpr size_t HEADER_SIZE = 16;                // Datagram header size
+  static constexpr size_t RECORD_HEADER_SIZE = 8;          // Record header size
+  static constexpr size_t DATAGRAM_SIZE = 512;             // Max datagram size (well below MTU)
+  static constexpr uint32_t FLUSH_INTERVAL_MS = 1000;      // Max age of a pending batch
+
+  /**
+   * Configure destination and batch size
+   * @param host IPv4 address in dotted notation
+   * @param port UDP port
+   * @param batch_size Max records per datagram
+   */
+  void configure(const char *host, uint16_t port, uint8_t batch_size);
+
+  /**
+   * Append a frame to the current batch, flushing when full
+   * @param frame Pointer to FRAME_SIZE frame bytes
+   * @param sequence Frame sequence number
+   * @param now_ms Frame timestamp (millis())
+   * @param flags Record flags
+   */
+  void add_frame(const volatile uint8_t *frame, uint32_t sequence, uint32_t now_ms, uint8_t flags);
+
+  /**
+   * Flush pending batch if it is older than FLUSH_INTERVAL_MS
+   * Called from loop() so slow frame rates still reach the receiver
+   */
+  void flush_if_due(uint32_t now_ms);
+
+  bool is_enabled() const { return enabled_; }
+  uint32_t get_datagrams_sent() const { return datagrams_sent_; }
+  uint32_t get_send_errors() const { return send_errors_; }
+
+ protected:
+  void flush();
+  void put_u16(uint16_t val);
+  void put_u32(uint32_t val);
+
+  bool enabled_{false};
+  int socket_{-1};                   // lwIP socket descriptor (opened lazily)
+  uint32_t addr_{0};                 // Destination IPv4 address (network order)
+  uint16_t port_{0};                 // Destination UDP port
+  uint8_t batch_size_{16};           // Max records per datagram
+
+  uint8_t datagram_[DATAGRAM_SIZE];  // Datagram being assembled
+  size_t length_{0};                 // Bytes used in datagram_
+  uint8_t count_{0};                 // Records in datagram_
+  uint8_t prev_frame_[FRAME_SIZE];   // Previous frame (delta reference)
+  uint32_t prev_seq_{0};             // Sequence of previous record
+  uint32_t prev_ms_{0};              // Timestamp of previous record
+  uint32_t batch_start_ms_{0};       // Timestamp of first record in batch
+
+  uint32_t datagrams_sent_{0};       // Datagrams successfully sent
+  uint32_t send_errors_{0};          // Failed sendto() calls
+};
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
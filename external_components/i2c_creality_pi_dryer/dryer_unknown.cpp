@@ -0,0 +1,84 @@
+#include "dryer_unknown.h"
+#include <cstdio>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+static const char *const KIND_NAMES[] = {"cursor", "units", "material", "error"};
+
+void UnknownPatternTable::record(Kind kind, const volatile uint8_t *bytes, uint8_t length, uint32_t now_ms) {
+    if (length > MAX_PATTERN) length = MAX_PATTERN;
+    LockGuard guard(lock_);
+
+    // Look for the pattern; remember a free slot, else the least hit (least recently seen) entry
+    Entry *victim = nullptr;
+    for (auto &entry : entries_) {
+        if (entry.length == 0) {
+            if (victim == nullptr || victim->length != 0) victim = &entry;
+            continue;
+        }
+        if (entry.kind == kind && entry.length == length) {
+            bool same = true;
+            for (uint8_t i = 0; i < length && same; i++) same = entry.bytes[i] == bytes[i];
+            if (same) {
+                entry.hits++;
+                entry.last_ms = now_ms;
+                return;
+            }
+        }
+        if (victim == nullptr || (victim->length != 0 &&
+            (entry.hits < victim->hits ||
+             (entry.hits == victim->hits && (now_ms - entry.last_ms) > (now_ms - victim->last_ms))))) {
+            victim = &entry;
+        }
+    }
+
+    if (victim->length != 0) evictions_++;
+    victim->kind = kind;
+    victim->length = length;
+    for (uint8_t i = 0; i < length; i++) victim->bytes[i] = bytes[i];
+    victim->first_ms = now_ms;
+    victim->last_ms = now_ms;
+    victim->hits = 1;
+}
+
+/**
+ * Render table as JSON
+ * Material entries also carry the XOR key used by the descriptor's MATERIAL_XOR table
+ */
+void UnknownPatternTable::render(std::string &out) {
+    LockGuard guard(lock_);
+    char line[160];
+
+    snprintf(line, sizeof(line), "{\"capacity\":%u,\"evictions\":%u,\"patterns\":[",
+             (unsigned)CAPACITY, (unsigned)evictions_);
+    out = line;
+
+    bool first = true;
+    for (const auto &entry : entries_) {
+        if (entry.length == 0) continue;
+        char hex[2 * MAX_PATTERN + 1];
+        uint8_t key = 0;
+        for (uint8_t i = 0; i < entry.length; i++) {
+            snprintf(hex + 2 * i, 3, "%02X", entry.bytes[i]);
+            key ^= entry.bytes[i];
+        }
+        hex[2 * entry.length] = '\0';
+
+        snprintf(line, sizeof(line), "%s{\"kind\":\"%s\",\"bytes\":\"%s\",", first ? "" : ",",
+                 KIND_NAMES[entry.kind], hex);
+        out += line;
+        if (entry.kind == MATERIAL) {
+            snprintf(line, sizeof(line), "\"xor\":\"%02X\",", key);
+            out += line;
+        }
+        snprintf(line, sizeof(line), "\"first_ms\":%u,\"last_ms\":%u,\"hits\":%u}",
+                 (unsigned)entry.first_ms, (unsigned)entry.last_ms, (unsigned)entry.hits);
+        out += line;
+        first = false;
+    }
+    out += "]}";
+}
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
@@ -0,0 +1,62 @@
+#pragma once
+#include "esphome/core/helpers.h"
+#include "dryer_protocol.h"
+#include <cstdint>
+#include <string>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+/**
+ * Table of distinct unrecognized byte patterns
+ *
+ * Collects the raw bytes of fields the protocol descriptor could not map
+ * (cursor masks, units bytes, material segments, error glyphs) so new dryer
+ * firmware states can be added to the descriptor without a logic analyzer.
+ * Patterns are deduplicated per field kind with first/last seen times and a
+ * hit count. The table is bounded: when full, the entry with the fewest hits
+ * (oldest on ties) is replaced, so one-off bus noise does not push out
+ * patterns that keep recurring.
+ *
+ * record() is only called on decode misses from loop(), render() from the web
+ * server task; both take the internal mutex.
+ */
+class UnknownPatternTable {
+ public:
+  enum Kind : uint8_t { CURSOR, UNITS, MATERIAL, ERROR_CODE };
+
+  static constexpr uint8_t CAPACITY = 16;                              // Distinct patterns kept
+  static constexpr uint8_t MAX_PATTERN = ActiveProtocol::MATERIAL_LENGTH;  // Longest field (bytes)
+
+  /**
+   * Count one occurrence of an unrecognized pattern
+   * @param kind Field the pattern was found in
+   * @param bytes Raw field bytes
+   * @param length Number of bytes (at most MAX_PATTERN)
+   * @param now_ms Time of the occurrence (millis())
+   */
+  void record(Kind kind, const volatile uint8_t *bytes, uint8_t length, uint32_t now_ms);
+
+  /**
+   * Render the table as JSON
+   * @param out Destination string
+   */
+  void render(std::string &out);
+
+ protected:
+  struct Entry {
+    uint8_t kind;
+    uint8_t length;                   // 0 = free slot
+    uint8_t bytes[MAX_PATTERN];
+    uint32_t first_ms;
+    uint32_t last_ms;
+    uint32_t hits;
+  };
+
+  Mutex lock_;
+  Entry entries_[CAPACITY]{};
+  uint32_t evictions_{0};             // Patterns replaced because the table was full
+};
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
@@ -2,54 +2,67 @@
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 #include <driver/gpio.h>
+#ifdef USE_CREALITY_DRYER_FAST_ISR
+#include <soc/gpio_reg.h>
+#endif
+#ifdef USE_CREALITY_DRYER_LIGHT_SLEEP
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <hal/gpio_ll.h>
+#include <soc/gpio_struct.h>
+#endif
+#include <cstdlib>
+#include <memory>
 
 namespace esphome {
 namespace i2c_creality_pi_dryer {
 
 // ============================================================================
-// Static Lookup Tables
+// Interrupt Service Routines (ISR)
 // ============================================================================
 
 /**
- * 7-segment display digit patterns
- * Index 0-9 represents digits 0-9, index 10 represents letter 'E' (for errors)
- * Each byte represents the segments that should be lit for that digit
+ * Global instance pointer for ISR access
+ * ISRs cannot be class methods, so we use a global pointer
  */
-const uint8_t I2CCrealityPiDryer::DIGITS[DIG_COUNT] = {
-    0xAF, 0xA0, 0xCB, 0xE9, 0xE4, 0x6D,
-    0x6F, 0xA8, 0xEF, 0xED, 0x4F
-};
+static I2CCrealityPiDryer* g_instance = nullptr;
 
 /**
- * Material identification XOR checksums
- * Each material type has a unique XOR checksum calculated from bytes 8-13
- * Used to identify which material is currently selected on the dryer
+ * Capture state (frame buffer and bus state machine, see dryer_capture.h)
+ * DRAM_ATTR keeps it accessible from the ISRs while flash cache is disabled
  */
-const uint8_t I2CCrealityPiDryer::MATERIAL_XOR[12] = {
-    0x27, 0x37, 0xEB, 0xFD, 0xE3, 0x19,
-    0x83, 0xFE, 0xF3, 0x93, 0x97, 0xE1
-};
+DRAM_ATTR CaptureState I2CCrealityPiDryer::capture_;
 
+#ifdef USE_CREALITY_DRYER_IDLE
 /**
- * Material name strings
- * Maps material index to human-readable name
- * Order must match MATERIAL_XOR array
+ * What the SCL ISRs need to leave low-power idle, resolved in setup()
+ * In DRAM so the per-edge suspended check does not go through g_instance.
  */
-const char* I2CCrealityPiDryer::MATERIAL_NAME[12] = {
-    "ABS", "ASA", "PETG", "PC", "PA", "PET",
-    "PLA-CF", "PETG-CF", "PA-CF", "PLA", "TPU", "PP"
+struct IdleWake {
+    IdleController *idle;       // The component's idle state machine
+    Component *component;       // Loop to re-enable
+    uint8_t scl_pin;            // SCL GPIO (interrupt type restored after light sleep)
 };
-
-// ============================================================================
-// Interrupt Service Routines (ISR)
-// ============================================================================
+static DRAM_ATTR IdleWake g_wake;
 
 /**
- * Global instance pointer for ISR access
- * ISRs cannot be class methods, so we use a global pointer
+ * Leave low-power idle on the first SCL edge
+ * Only reached while suspended, so the per-edge cost is the state check in the
+ * caller; later edges until leave_idle() find the state WAKING and do nothing.
+ * millis() is read once per wake, for the wake latency.
  */
-static I2CCrealityPiDryer* g_instance = nullptr;
+static void IRAM_ATTR wake_from_idle() {
+    if (!g_wake.idle->on_edge(millis())) return;
+#ifdef USE_CREALITY_DRYER_LIGHT_SLEEP
+    // Light sleep is left on a low level; switch back to rising edges at once
+    // so the rest of the first frame is captured
+    gpio_ll_set_intr_type(&GPIO, g_wake.scl_pin, GPIO_INTR_POSEDGE);
+#endif
+    g_wake.component->enable_loop_soon_any_context();
+}
+#endif
 
+#ifndef USE_CREALITY_DRYER_FAST_ISR
 /**
  * SCL (Clock) interrupt handler
  * Triggered on rising edge of SCL signal
@@ -60,35 +73,30 @@ static I2CCrealityPiDryer* g_instance = nullptr;
 void IRAM_ATTR handle_scl_interrupt() {
     if (!g_instance) return;
     
-    uint32_t now = micros();
-    I2CStatus status = static_cast<I2CStatus>(g_instance->i2c_status_);
-    
-    // Only process if actively receiving data
-    if (status != I2CStatus::RECEIVING) {
-        g_instance->last_edge_time_ = now;
+#ifdef USE_CREALITY_DRYER_IDLE
+    // Suspended: the edge only wakes the loop, capture resumes in leave_idle()
+    // (with light sleep this is the level-triggered wake interrupt, so the
+    // pins are not sampled)
+    if (g_wake.idle->is_suspended()) {
+        wake_from_idle();
         return;
     }
+#endif
     
-    if (!g_instance->wait_ack_) {
-        // Read SDA line and shift into byte buffer
-        g_instance->byte_tmp_ = (g_instance->byte_tmp_ << 1) | gpio_get_level((gpio_num_t)g_instance->sda_pin_);
-        g_instance->bit_num_++;
-        
-        // Complete byte received (8 bits)
-        if (g_instance->bit_num_ == 8) {
-            if (g_instance->byte_num_ < I2CCrealityPiDryer::BUFFER_SIZE) {
-                g_instance->buffer_[g_instance->byte_num_++] = g_instance->byte_tmp_;
-            }
-            g_instance->byte_tmp_ = 0;
-            g_instance->bit_num_ = 0;
-            g_instance->wait_ack_ = true;  // Next bit will be ACK
-        }
-    } else {
-        // Skip ACK bit
-        g_instance->wait_ack_ = false;
+    CaptureState &cap = I2CCrealityPiDryer::capture_;
+    uint32_t start = cap.profile ? arch_get_cpu_cycle_count() : 0;
+    uint32_t now = micros();
+    
+#ifdef USE_CREALITY_DRYER_BUS_LOGGER
+    // Transaction logger keeps its own bit position (independent of frame processing)
+    if (g_instance->bus_logger_.is_capturing()) {
+        g_instance->bus_logger_.on_clock(gpio_get_level((gpio_num_t)g_instance->sda_pin_));
     }
+#endif
     
-    g_instance->last_edge_time_ = now;
+    capture_clock(cap, [] { return gpio_get_level((gpio_num_t)g_instance->sda_pin_); });
+    cap.last_edge = now;
+    if (cap.profile) cap.scl_cycles.add(arch_get_cpu_cycle_count() - start);
 }
 
 /**
@@ -102,27 +110,120 @@ void IRAM_ATTR handle_scl_interrupt() {
 void IRAM_ATTR handle_sda_interrupt() {
     if (!g_instance) return;
     
+    CaptureState &cap = I2CCrealityPiDryer::capture_;
+    uint32_t start = cap.profile ? arch_get_cpu_cycle_count() : 0;
+    uint32_t now = micros();
     int scl = gpio_get_level((gpio_num_t)g_instance->scl_pin_);
     int sda = gpio_get_level((gpio_num_t)g_instance->sda_pin_);
     
-    if (scl == 1) {  // SCL is HIGH
-        if (sda == 0) {  // SDA is LOW - START condition detected
-            g_instance->i2c_status_ = static_cast<uint8_t>(I2CStatus::RECEIVING);
-            g_instance->byte_num_ = 0;
-            g_instance->bit_num_ = 0;
-            g_instance->byte_tmp_ = 0;
-            g_instance->wait_ack_ = false;
-        } else {  // SDA is HIGH - STOP condition detected
-            I2CStatus status = static_cast<I2CStatus>(g_instance->i2c_status_);
-            if (status == I2CStatus::RECEIVING || status == I2CStatus::BUSY) {
-                g_instance->i2c_status_ = static_cast<uint8_t>(I2CStatus::STOP);
-            }
-        }
+    [[maybe_unused]] CaptureEvent event = capture_data(cap, scl, sda);
+#ifdef USE_CREALITY_DRYER_BUS_LOGGER
+    if (event == CaptureEvent::START) {
+        g_instance->bus_logger_.on_start(now, cap.last_edge);
+    } else if (event == CaptureEvent::STOP) {
+        g_instance->bus_logger_.on_stop(now);
     }
+#endif
     
-    g_instance->last_edge_time_ = micros();
+    cap.last_edge = now;
+    if (cap.profile) cap.sda_cycles.add(arch_get_cpu_cycle_count() - start);
+}
+#else
+/**
+ * Register-level ISR fast path (fast_isr: true)
+ * 
+ * Pin levels are read straight from the GPIO input register with masks
+ * resolved in setup(), and edges are stamped with the CPU cycle counter
+ * instead of micros(). Converting stamps to time is left to loop(); the
+ * transaction logger converts its START/STOP stamps with a CycleClock that
+ * loop() keeps anchored. Everything the handlers touch is reached through
+ * g_fast and g_wake, never through g_instance.
+ */
+struct FastIsrContext {
+    const volatile uint32_t *scl_in;  // Input register holding SCL
+    const volatile uint32_t *sda_in;  // Input register holding SDA
+    uint32_t scl_mask;                // SCL bit in scl_in
+    uint32_t sda_mask;                // SDA bit in sda_in
+#ifdef USE_CREALITY_DRYER_BUS_LOGGER
+    BusLogger *bus_logger;            // The component's transaction logger
+    CycleClock clock;                 // Cycle stamps to micros() for the logger
+#endif
+};
+static DRAM_ATTR FastIsrContext g_fast;
+
+/**
+ * Input register of a GPIO (pins 32-39 live in the second bank on ESP32)
+ */
+static const volatile uint32_t *gpio_in_register(uint8_t pin) {
+#ifdef GPIO_IN1_REG
+    if (pin >= 32) return (const volatile uint32_t *) GPIO_IN1_REG;
+#endif
+    return (const volatile uint32_t *) GPIO_IN_REG;
 }
 
+#ifdef USE_CREALITY_DRYER_BUS_LOGGER
+/**
+ * Pair the cycle counter with micros() for the logger's conversions
+ * Called from loop() (same core as the ISRs) and before capture resumes
+ * after idle, since light sleep stops the cycle counter.
+ */
+static void refresh_cycle_clock() {
+    g_fast.clock.set_anchor(arch_get_cpu_cycle_count(), micros());
+}
+#endif
+
+/**
+ * SCL rising edge (fast path)
+ */
+void IRAM_ATTR handle_scl_interrupt_fast() {
+#ifdef USE_CREALITY_DRYER_IDLE
+    // Suspended: wake only, no capture (see handle_scl_interrupt())
+    if (g_wake.idle->is_suspended()) {
+        wake_from_idle();
+        return;
+    }
+#endif
+    
+    CaptureState &cap = I2CCrealityPiDryer::capture_;
+    uint32_t now = arch_get_cpu_cycle_count();
+    auto read_sda = [] { return (*g_fast.sda_in & g_fast.sda_mask) ? 1 : 0; };
+    
+#ifdef USE_CREALITY_DRYER_BUS_LOGGER
+    if (g_fast.bus_logger->is_capturing()) g_fast.bus_logger->on_clock(read_sda());
+#endif
+    
+    capture_clock(cap, read_sda);
+    cap.last_edge = now;
+    if (cap.profile) cap.scl_cycles.add(arch_get_cpu_cycle_count() - now);
+}
+
+/**
+ * SDA edge (fast path)
+ */
+void IRAM_ATTR handle_sda_interrupt_fast() {
+    CaptureState &cap = I2CCrealityPiDryer::capture_;
+    uint32_t now = arch_get_cpu_cycle_count();
+    int scl = (*g_fast.scl_in & g_fast.scl_mask) ? 1 : 0;
+    int sda = (*g_fast.sda_in & g_fast.sda_mask) ? 1 : 0;
+    
+#ifdef USE_CREALITY_DRYER_BUS_LOGGER
+    // A repeated START ends the open transaction at the previous edge
+    uint32_t prev_edge = cap.last_edge;
+#endif
+    [[maybe_unused]] CaptureEvent event = capture_data(cap, scl, sda);
+#ifdef USE_CREALITY_DRYER_BUS_LOGGER
+    if (event == CaptureEvent::START) {
+        g_fast.bus_logger->on_start(g_fast.clock.to_us(now), g_fast.clock.to_us(prev_edge));
+    } else if (event == CaptureEvent::STOP) {
+        g_fast.bus_logger->on_stop(g_fast.clock.to_us(now));
+    }
+#endif
+    
+    cap.last_edge = now;
+    if (cap.profile) cap.sda_cycles.add(arch_get_cpu_cycle_count() - now);
+}
+#endif
+
 // ============================================================================
 // Component Lifecycle Methods
 // ============================================================================
@@ -149,25 +250,86 @@ void I2CCrealityPiDryer::setup() {
     // Install GPIO ISR service (required before adding handlers)
     gpio_install_isr_service(0);
     
+    // ISR cycle counts are only collected for the statistics report
+    capture_.profile = enable_statistics_;
+    
+#ifdef USE_CREALITY_DRYER_IDLE
+    // Wake path of the SCL ISRs
+    g_wake.idle = &idle_;
+    g_wake.component = this;
+    g_wake.scl_pin = scl_pin_;
+#endif
+    
+#ifdef USE_CREALITY_DRYER_FAST_ISR
+    // Resolve input registers and pin masks once for the fast ISRs
+    g_fast.scl_in = gpio_in_register(scl_pin_);
+    g_fast.sda_in = gpio_in_register(sda_pin_);
+    g_fast.scl_mask = 1u << (scl_pin_ & 31);
+    g_fast.sda_mask = 1u << (sda_pin_ & 31);
+#ifdef USE_CREALITY_DRYER_BUS_LOGGER
+    g_fast.bus_logger = &bus_logger_;
+    g_fast.clock.cycles_per_us = arch_get_cpu_freq_hz() / 1000000;
+    refresh_cycle_clock();
+#endif
+    gpio_isr_t scl_handler = (gpio_isr_t)handle_scl_interrupt_fast;
+    gpio_isr_t sda_handler = (gpio_isr_t)handle_sda_interrupt_fast;
+#else
+    gpio_isr_t scl_handler = (gpio_isr_t)handle_scl_interrupt;
+    gpio_isr_t sda_handler = (gpio_isr_t)handle_sda_interrupt;
+#endif
+    
     // Attach interrupt handlers
     // SCL: Trigger on rising edge (when data is stable)
     gpio_set_intr_type((gpio_num_t)scl_pin_, GPIO_INTR_POSEDGE);
-    gpio_isr_handler_add((gpio_num_t)scl_pin_, (gpio_isr_t)handle_scl_interrupt, nullptr);
+    gpio_isr_handler_add((gpio_num_t)scl_pin_, scl_handler, nullptr);
     
     // SDA: Trigger on any edge (to detect START/STOP conditions)
     gpio_set_intr_type((gpio_num_t)sda_pin_, GPIO_INTR_ANYEDGE);
-    gpio_isr_handler_add((gpio_num_t)sda_pin_, (gpio_isr_t)handle_sda_interrupt, nullptr);
+    gpio_isr_handler_add((gpio_num_t)sda_pin_, sda_handler, nullptr);
+    
+#ifdef USE_CREALITY_DRYER_RECORDER
+    // Open flash ring for raw frame recording (disabled if the partition is missing)
+    recorder_.begin();
+#endif
+    
+#ifdef USE_CREALITY_DRYER_SESSIONS
+    // Load drying session history and show the last finished session
+    sessions_.begin();
+    publish_session();
+#endif
+    
+#ifdef USE_CREALITY_DRYER_WEB
+    // Register diagnostic endpoints with the web server
+    web_server_base_->init();
+    web_server_base_->add_handler(this);
+#endif
     
     // Initialize state
-    i2c_status_ = static_cast<uint8_t>(I2CStatus::READY);
+    capture_.status = static_cast<uint8_t>(I2CStatus::READY);
     last_packet_time_ = millis();
     last_yield_time_ = millis();
     
-    // Publish initial sensor states
+    // Publish initial sensor states (mirrored into the snapshot)
+#ifdef USE_CREALITY_DRYER_DRYING_TIME
     if (drying_time_sensor_) drying_time_sensor_->publish_state("00:00:00");
+    snapshot_.drying_time = 0;
+#endif
+#ifdef USE_CREALITY_DRYER_ERROR_STATUS
     if (error_status_sensor_) error_status_sensor_->publish_state("OK");
+    snapshot_.error = "OK";
+#endif
+#ifdef USE_CREALITY_DRYER_DRYER_STATUS
     if (dryer_status_sensor_) dryer_status_sensor_->publish_state("Off");
+#endif
+#ifdef USE_CREALITY_DRYER_TEMP_UNITS
     if (temp_units_sensor_) temp_units_sensor_->publish_state("C");
+    snapshot_.units = "C";
+#endif
+    
+#ifdef USE_CREALITY_DRYER_IDLE
+    // The dryer starts as off: idle after the enter delay unless frames arrive
+    idle_.on_power_off(millis());
+#endif
     
     ESP_LOGI(TAG, "I2C sniffer initialized successfully");
 }
@@ -184,11 +346,45 @@ void I2CCrealityPiDryer::loop() {
         last_yield_time_ = current_millis;
     }
     
+#ifdef USE_CREALITY_DRYER_IDLE
+    // Low-power idle while the dryer is off
+    switch (idle_.poll(current_millis)) {
+        case IdleController::Action::ENTER_IDLE:
+            enter_idle();
+            return;
+        case IdleController::Action::RESUME:
+            leave_idle();
+            break;
+        default:
+            break;
+    }
+#endif
+    
+#if defined(USE_CREALITY_DRYER_FAST_ISR) && defined(USE_CREALITY_DRYER_BUS_LOGGER)
+    // Keep the logger's cycle-to-micros() conversion anchored
+    refresh_cycle_clock();
+#endif
+    
     // Check for timeouts
     handle_timeouts();
     
+    // Periodic statistics report
+    if (enable_statistics_ && (current_millis - last_stats_time_) >= LOG_INTERVAL_MS) {
+        log_statistics();
+    }
+    
+#ifdef USE_CREALITY_DRYER_TELEMETRY
+    // Push out partially filled telemetry batches
+    telemetry_.flush_if_due(current_millis);
+#endif
+    
+#ifdef USE_CREALITY_DRYER_RECORDER
+    // Persist recorder batch that has been waiting too long
+    recorder_.flush_if_due(current_millis);
+#endif
+    
     // Process complete packets
-    if (i2c_status_ == static_cast<uint8_t>(I2CStatus::STOP)) {
+    if (capture_.status == static_cast<uint8_t>(I2CStatus::STOP)) {
         process_packet();
     }
 }
@@ -200,38 +396,162 @@ void I2CCrealityPiDryer::loop() {
 /**
  * Handle I2C communication and device timeouts
  * Detects when communication is lost or device is disconnected
+ *
+ * Power-off is detected from bus silence: the ISRs time-stamp every edge and
+ * PowerDetector (dryer_power.h, shared with tools/dryer_replay.h) decides
+ * from the silence and the time since the last valid packet.
  */
 void I2CCrealityPiDryer::handle_timeouts() {
+    // Sample edge time before the clock so an edge arriving in between
+    // cannot make the difference wrap around
+    uint32_t last_edge = get_last_edge_us();
     uint32_t current_micros = micros();
     uint32_t current_millis = millis();
+    uint32_t silence_us = current_micros - last_edge;
     
     // I2C communication timeout (200 microseconds)
-    if (i2c_status_ == static_cast<uint8_t>(I2CStatus::RECEIVING)) {
-        if ((current_micros - last_edge_time_) > I2C_TIMEOUT_US) {
-            // Timeout occurred - mark packet as complete if data received
-            i2c_status_ = (byte_num_ > 0) ? static_cast<uint8_t>(I2CStatus::STOP) : static_cast<uint8_t>(I2CStatus::READY);
-        }
+    // Timeout occurred - mark packet as complete if data received
+    if (silence_us > I2C_TIMEOUT_US) capture_timeout(capture_);
+    
+    if (device_state_ == DeviceState::OFF) return;
+    
+    // Bus silence at the frame-period scale, or no valid packet for DEVICE_TIMEOUT_MS
+    bool bus_silent;
+    if (power_.is_off(silence_us / 1000, current_millis - last_packet_time_, bus_silent)) {
+        ESP_LOGI(TAG, "Dryer off (%s, %u ms since last packet)", bus_silent ? "bus silent" : "no valid frames",
+                 (unsigned)(current_millis - last_packet_time_));
+        handle_device_state_change(DeviceState::OFF);
+        reset_all_states();
+        power_.reset();
+        publish_power_off();
+#ifdef USE_CREALITY_DRYER_IDLE
+        idle_.on_power_off(current_millis);
+#endif
     }
+}
+
+/**
+ * Time of the last bus edge in micros()
+ */
+uint32_t I2CCrealityPiDryer::get_last_edge_us() {
+#ifdef USE_CREALITY_DRYER_FAST_ISR
+    uint32_t stamp = capture_.last_edge;
+    if (stamp != last_edge_stamp_) {
+        // Age of the stamp in cycles, then in microseconds before now
+        uint32_t age_cycles = arch_get_cpu_cycle_count() - stamp;
+        last_edge_us_ = micros() - age_cycles / (arch_get_cpu_freq_hz() / 1000000);
+        last_edge_stamp_ = stamp;
+    }
+    return last_edge_us_;
+#else
+    return capture_.last_edge;
+#endif
+}
+
+/**
+ * Publish the off transition as one batch
+ * Status goes first so automations waiting on dryer_status react immediately;
+ * the other channels are cleared in the same pass, but only if they currently
+ * hold a value, and the aggregated snapshot carries the whole change set.
+ */
+void I2CCrealityPiDryer::publish_power_off() {
+#ifdef USE_CREALITY_DRYER_DRYER_STATUS
+    if (dryer_status_sensor_) dryer_status_sensor_->publish_state("Off");
+#endif
+#ifdef USE_CREALITY_DRYER_SET_TEMP
+    if (set_temp_sensor_ && snapshot_.set_temp != 255) set_temp_sensor_->publish_state(NAN);
+#endif
+#ifdef USE_CREALITY_DRYER_CURRENT_TEMP
+    if (current_temp_sensor_ && snapshot_.current_temp != 255) current_temp_sensor_->publish_state(NAN);
+#endif
+#ifdef USE_CREALITY_DRYER_HUMIDITY
+    if (humidity_sensor_ && snapshot_.humidity != 255) humidity_sensor_->publish_state(NAN);
+#endif
+#ifdef USE_CREALITY_DRYER_DRYING_TIME
+    if (drying_time_sensor_ && snapshot_.drying_time != UINT32_MAX) drying_time_sensor_->publish_state("Unknown");
+#endif
+#ifdef USE_CREALITY_DRYER_MATERIAL
+    if (material_sensor_ && snapshot_.material) material_sensor_->publish_state("N/A");
+#endif
+#ifdef USE_CREALITY_DRYER_CURSOR
+    if (cursor_sensor_ && snapshot_.cursor) cursor_sensor_->publish_state("N/A");
+#endif
+#ifdef USE_CREALITY_DRYER_TEMP_UNITS
+    if (temp_units_sensor_ && snapshot_.units) temp_units_sensor_->publish_state("N/A");
+#endif
+#ifdef USE_CREALITY_DRYER_ERROR_STATUS
+    if (error_status_sensor_ && snapshot_.error) error_status_sensor_->publish_state("N/A");
+#endif
     
-    // Device disconnection timeout (3 seconds)
-    if ((current_millis - last_packet_time_) > DEVICE_TIMEOUT_MS) {
-        if (device_state_ != DeviceState::OFF) {
-            handle_device_state_change(DeviceState::OFF);
-            reset_all_states();
-            
-            // Publish "disconnected" states to all sensors
-            if (dryer_status_sensor_) dryer_status_sensor_->publish_state("Off");
-            if (set_temp_sensor_) set_temp_sensor_->publish_state(NAN);
-            if (current_temp_sensor_) current_temp_sensor_->publish_state(NAN);
-            if (humidity_sensor_) humidity_sensor_->publish_state(NAN);
-            if (drying_time_sensor_) drying_time_sensor_->publish_state("Unknown");
-            if (material_sensor_) material_sensor_->publish_state("N/A");
-            if (cursor_sensor_) cursor_sensor_->publish_state("N/A");
-            if (temp_units_sensor_) temp_units_sensor_->publish_state("N/A");
-            if (error_status_sensor_) error_status_sensor_->publish_state("N/A");
-        }
+    // Mirror the disconnect into the aggregated snapshot as one change set
+    snapshot_ = DryerSnapshot{};
+    first_publish_pending_ = false;
+    mark_changed();
+    publish_snapshot();
+}
+
+#ifdef USE_CREALITY_DRYER_IDLE
+/**
+ * Enter low-power idle
+ * Called once the dryer has been off for the enter delay, so pending
+ * telemetry and recorder batches have already been flushed by loop().
+ */
+void I2CCrealityPiDryer::enter_idle() {
+    ESP_LOGI(TAG, "Dryer off for %u ms, entering low-power idle", (unsigned)idle_.get_enter_delay_ms());
+#ifdef USE_CREALITY_DRYER_LIGHT_SLEEP
+    // GPIO wake from light sleep is level-triggered: SCL idles high, so the
+    // first clock pulse pulls it low (this turns the SCL interrupt into a
+    // low-level one until the ISR restores rising edges)
+    gpio_wakeup_enable((gpio_num_t)scl_pin_, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    configure_light_sleep(true);
+#endif
+    // Nothing is captured while idle, so START/STOP detection is off as well
+    gpio_intr_disable((gpio_num_t)sda_pin_);
+    disable_loop();
+}
+
+/**
+ * Leave low-power idle
+ * Wake latency is the time from the waking edge to this call: the ISR only
+ * requests the loop, which runs again on the next main loop pass (bounded by
+ * the main loop interval, 16 ms by default, plus the light sleep exit).
+ */
+void I2CCrealityPiDryer::leave_idle() {
+#ifdef USE_CREALITY_DRYER_LIGHT_SLEEP
+    configure_light_sleep(false);
+    gpio_wakeup_disable((gpio_num_t)scl_pin_);
+    gpio_set_intr_type((gpio_num_t)scl_pin_, GPIO_INTR_POSEDGE);
+#endif
+#if defined(USE_CREALITY_DRYER_FAST_ISR) && defined(USE_CREALITY_DRYER_BUS_LOGGER)
+    // The cycle counter stopped in light sleep; re-anchor before the logger sees a START
+    refresh_cycle_clock();
+#endif
+    // Capture resumes with the next START (idle_ is no longer suspended)
+    gpio_intr_enable((gpio_num_t)sda_pin_);
+    ESP_LOGI(TAG, "Bus activity, left low-power idle (wake latency %u ms, max %u ms)",
+             (unsigned)idle_.get_last_wake_latency_ms(), (unsigned)idle_.get_max_wake_latency_ms());
+}
+#endif
+
+#ifdef USE_CREALITY_DRYER_LIGHT_SLEEP
+/**
+ * Allow or forbid automatic light sleep
+ * The CPU clock is pinned to its current frequency, so cycle counts (ISR
+ * profiling, fast_isr stamps) keep their meaning.
+ */
+void I2CCrealityPiDryer::configure_light_sleep(bool enable) {
+    int mhz = arch_get_cpu_freq_hz() / 1000000;
+    esp_pm_config_t pm_config = {};
+    pm_config.max_freq_mhz = mhz;
+    pm_config.min_freq_mhz = mhz;
+    pm_config.light_sleep_enable = enable;
+    esp_err_t err = esp_pm_configure(&pm_config);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Light sleep %s failed: %s", enable ? "enable" : "disable", esp_err_to_name(err));
     }
 }
+#endif
 
 // ============================================================================
 // Packet Processing
@@ -240,51 +560,196 @@ void I2CCrealityPiDryer::handle_timeouts() {
 /**
  * Process received I2C packet
  * Validates packet, decodes values, and publishes to sensors
+ *
+ * Frames truncated by the ISR timeout are salvaged field by field: every
+ * field whose byte range was fully received is decoded and fed to its filter,
+ * the rest keep their "invalid" default. Raw-frame consumers (telemetry,
+ * recorder, display mirror) only see complete frames.
  */
 void I2CCrealityPiDryer::process_packet() {
-    i2c_status_ = static_cast<uint8_t>(I2CStatus::BUSY);
+    // Stage timing shares the ISR profiling switch (statistics: true), so
+    // the cycle counter is not read at all with statistics disabled
+    const bool profile = capture_.profile;
+    uint32_t packet_start = profile ? arch_get_cpu_cycle_count() : 0;
+    capture_.status = static_cast<uint8_t>(I2CStatus::BUSY);
+    
+    // Field offsets come from the selected model's protocol descriptor
+    using P = ActiveProtocol;
+    uint8_t received = capture_.byte_num;
+    bool complete = received >= P::FRAME_SIZE;
     
-    // Validate packet length and address
-    if (byte_num_ < 22 || buffer_[0] != I2C_DEVICE_ADDRESS) {
+    // Validate address; a truncated frame must at least contain the first field (cursor)
+    if (received <= P::CURSOR_OFFSET || capture_.buffer[0] != P::ADDRESS) {
         stats_.invalid_packets++;
-        i2c_status_ = static_cast<uint8_t>(I2CStatus::READY);
+        capture_.status = static_cast<uint8_t>(I2CStatus::READY);
         return;
     }
     
-    stats_.valid_packets++;
-    last_packet_time_ = millis();
+    // Field is usable if its whole byte range was received
+    uint8_t salvaged_fields = 0;
+    auto has_field = [received, &salvaged_fields](uint8_t offset, uint8_t length) {
+        if (received < offset + length) return false;
+        salvaged_fields++;
+        return true;
+    };
+    
+    // Salvaged fields only refine a running dryer; powering on takes a complete frame
+    if (!complete && device_state_ == DeviceState::OFF) {
+        stats_.invalid_packets++;
+        capture_.status = static_cast<uint8_t>(I2CStatus::READY);
+        return;
+    }
+    
+    // Every decoded frame is stamped for the filters, but only complete frames
+    // keep the dryer on (last_packet_time_) and feed the frame period estimate
+    packet_time_ = millis();
+    if (complete) {
+        // Track frame period for silence-based power-off detection
+        if (device_state_ != DeviceState::OFF) power_.on_frame(packet_time_ - last_packet_time_);
+        last_packet_time_ = packet_time_;
+        stats_.valid_packets++;
+        frame_sequence_++;
+    }
     
     // Update device state if coming from OFF
     if (device_state_ == DeviceState::OFF) {
         handle_device_state_change(DeviceState::STARTING);
+        power_on_time_ = packet_time_;
+        first_publish_pending_ = true;
+#ifdef USE_CREALITY_DRYER_IDLE
+        idle_.on_power_on();
+#endif
+    }
+    
+#ifdef USE_CREALITY_DRYER_TELEMETRY
+    // Stream raw frame to telemetry receiver
+    if (complete) {
+        uint8_t flags = (error_state_.active() ? 0x01 : 0x00) |
+                        (static_cast<uint8_t>(device_state_) << 1);
+        telemetry_.add_frame(capture_.buffer, frame_sequence_, packet_time_, flags);
     }
+#endif
     
-    // Decode all values from packet buffer
-    uint8_t sv = decode_digit(buffer_[3], buffer_[4], true);    // Set value (target temp)
-    uint8_t pv = decode_digit(buffer_[5], buffer_[6], true);    // Process value (current temp)
-    uint8_t rh = decode_digit(buffer_[14], buffer_[15]);        // Relative humidity
-    uint8_t hh = decode_digit(buffer_[16], buffer_[17]);        // Hours
-    uint8_t mm = decode_digit(buffer_[18], buffer_[19]);        // Minutes
-    uint8_t ss = decode_digit(buffer_[20], buffer_[21]);        // Seconds
-    int mat_idx = decode_material_idx(buffer_);                 // Material index
-    const char* cursor = get_cursor_name(buffer_[2]);           // Cursor position
-    const char* units = get_units(buffer_[7]);                  // Temperature units
+#ifdef USE_CREALITY_DRYER_RECORDER
+    // Append raw frame to the flash ring (batched, written from RAM)
+    if (complete) recorder_.add_frame(capture_.buffer, packet_time_);
+#endif
+    
+#ifdef USE_CREALITY_DRYER_DISPLAY_MIRROR
+    // Mirror every segment of the frame (rendering is deferred to web requests)
+    if (complete) display_mirror_.update(capture_.buffer, frame_sequence_);
+#endif
+    
+    // Decode configured values from packet buffer
+    // Channels that neither a sensor nor session tracking needs keep their
+    // "invalid" default and their decode is compiled out (PV is always decoded
+    // for error detection), as do fields missing from a truncated frame
+    uint8_t sv = 255, pv = 255, rh = 255, hh = 255, mm = 255, ss = 255;
+    int mat_idx = -1;
+    const char* cursor = Decoder::UNKNOWN;
+    const char* units = Decoder::UNKNOWN;
+    bool has_pv = false;
+    [[maybe_unused]] bool has_material = false, has_cursor = false, has_units = false;  // For pattern capture
+    uint32_t decode_start = profile ? arch_get_cpu_cycle_count() : 0;
+    uint8_t digit_calls = 0;
+#ifdef CREALITY_DRYER_DECODE_SET_TEMP
+    if (has_field(P::SV_OFFSET, 2)) {
+        sv = Decoder::decode_digit(capture_.buffer[P::SV_OFFSET], capture_.buffer[P::SV_OFFSET + 1], true);       // Set value (target temp)
+        digit_calls++;
+    }
+#endif
+    if ((has_pv = has_field(P::PV_OFFSET, 2))) {
+        pv = Decoder::decode_digit(capture_.buffer[P::PV_OFFSET], capture_.buffer[P::PV_OFFSET + 1], true);       // Process value (current temp)
+        digit_calls++;
+    }
+#ifdef CREALITY_DRYER_DECODE_HUMIDITY
+    if (has_field(P::RH_OFFSET, 2)) {
+        rh = Decoder::decode_digit(capture_.buffer[P::RH_OFFSET], capture_.buffer[P::RH_OFFSET + 1]);             // Relative humidity
+        digit_calls++;
+    }
+#endif
+#ifdef CREALITY_DRYER_DECODE_TIME
+    // Time is only meaningful with all three digit pairs (i.e. a complete frame)
+    if (has_field(P::HOURS_OFFSET, P::SECONDS_OFFSET + 2 - P::HOURS_OFFSET)) {
+        hh = Decoder::decode_digit(capture_.buffer[P::HOURS_OFFSET], capture_.buffer[P::HOURS_OFFSET + 1]);       // Hours
+        mm = Decoder::decode_digit(capture_.buffer[P::MINUTES_OFFSET], capture_.buffer[P::MINUTES_OFFSET + 1]);   // Minutes
+        ss = Decoder::decode_digit(capture_.buffer[P::SECONDS_OFFSET], capture_.buffer[P::SECONDS_OFFSET + 1]);   // Seconds
+        digit_calls += 3;
+    }
+#endif
+    uint32_t material_start = profile ? arch_get_cpu_cycle_count() : 0;
+#ifdef CREALITY_DRYER_DECODE_MATERIAL
+    if ((has_material = has_field(P::MATERIAL_OFFSET, P::MATERIAL_LENGTH))) {
+        mat_idx = Decoder::decode_material_idx(capture_.buffer);                                          // Material index
+    }
+#endif
+    uint32_t material_end = profile ? arch_get_cpu_cycle_count() : 0;
+#ifdef CREALITY_DRYER_DECODE_CURSOR
+    if ((has_cursor = has_field(P::CURSOR_OFFSET, 1))) {
+        cursor = Decoder::get_cursor_name(capture_.buffer[P::CURSOR_OFFSET]);                             // Cursor position
+    }
+#endif
+#ifdef USE_CREALITY_DRYER_TEMP_UNITS
+    if ((has_units = has_field(P::UNITS_OFFSET, 1))) {
+        units = Decoder::get_units(capture_.buffer[P::UNITS_OFFSET]);                                     // Temperature units
+    }
+#endif
+    
+    if (!complete) {
+        stats_.salvaged_packets++;
+        stats_.salvaged_fields += salvaged_fields;
+    }
+    
+#ifdef USE_CREALITY_DRYER_UNKNOWN_PATTERNS
+    // Capture decode misses for protocol discovery (known patterns never get here)
+#ifdef USE_CREALITY_DRYER_MATERIAL
+    if (has_material && mat_idx < 0) {
+        unknown_patterns_.record(UnknownPatternTable::MATERIAL, &capture_.buffer[P::MATERIAL_OFFSET],
+                                 P::MATERIAL_LENGTH, packet_time_);
+    }
+#endif
+#ifdef USE_CREALITY_DRYER_CURSOR
+    if (has_cursor && cursor == Decoder::UNKNOWN) {
+        uint8_t cursor_bits = capture_.buffer[P::CURSOR_OFFSET] & P::CURSOR_MASK;
+        unknown_patterns_.record(UnknownPatternTable::CURSOR, &cursor_bits, 1, packet_time_);
+    }
+#endif
+#ifdef USE_CREALITY_DRYER_TEMP_UNITS
+    if (has_units && units == Decoder::UNKNOWN) {
+        unknown_patterns_.record(UnknownPatternTable::UNITS, &capture_.buffer[P::UNITS_OFFSET], 1, packet_time_);
+    }
+#endif
+#endif
     
     // Periodic debug logging (every 30 seconds)
     if ((millis() - last_log_time_) > LOG_INTERVAL_MS) {
         ESP_LOGD(TAG, "SV=%d PV=%d RH=%d Time=%02d:%02d:%02d Mat=%d Err=%s", 
                  sv, pv, rh, hh, mm, ss, mat_idx,
-                 error_state_.error_active ? error_state_.last_error : "OK");
+                 error_name(error_state_.code));
         last_log_time_ = millis();
     }
     
-    // Handle error detection
-    handle_pv_error(pv, buffer_[5], buffer_[6]);
+    // Handle error detection (a missing PV field must not count as a normal reading)
+    bool error_frame = has_pv && handle_pv_error(pv, capture_.buffer[P::PV_OFFSET], capture_.buffer[P::PV_OFFSET + 1]);
+    
+    // Filter and publish all values (held while the display shows an error code)
+    uint32_t filter_start = profile ? arch_get_cpu_cycle_count() : 0;
+    if (!error_frame) filter_and_publish_values(sv, pv, rh, hh, mm, ss, mat_idx, cursor, units);
+    uint32_t filter_end = profile ? arch_get_cpu_cycle_count() : 0;
     
-    // Filter and publish all values
-    filter_and_publish_values(sv, pv, rh, hh, mm, ss, mat_idx, cursor, units);
+    // Emit at most one aggregated snapshot per frame
+    publish_snapshot();
     
-    i2c_status_ = static_cast<uint8_t>(I2CStatus::READY);
+    // Stage timings (cycle counter wraps safely with unsigned subtraction)
+    // Only complete frames are timed so runs with different salvage rates compare
+    if (profile && complete) {
+        profile_.decode_digit.add(material_start - decode_start, digit_calls);
+        profile_.decode_material.add(material_end - material_start);
+        profile_.filter.add(filter_end - filter_start);
+        profile_.packet.add(arch_get_cpu_cycle_count() - packet_start);
+    }
+    
+    capture_.status = static_cast<uint8_t>(I2CStatus::READY);
 }
 
 // ============================================================================
@@ -296,104 +761,118 @@ void I2CCrealityPiDryer::process_packet() {
  * Implements debouncing to prevent false error triggers from I2C noise
  * 
  * Error format on display: "E" + digit (e.g., "E0", "E5")
- * pv == 225 indicates error display mode
+ * pv == 225 indicates error display mode; Decoder::classify_pv() decides
+ * whether a frame is an error, normal or noise (shared with tools/filter_replay.cpp)
+ * 
+ * Errors are tracked as one-byte codes; names are only looked up when a
+ * change is published, so error frames cost no string formatting.
  * 
  * @param pv Process value (225 = error mode)
  * @param high_byte High digit byte (letter 'E')
  * @param low_byte Low digit byte (error number 0-9)
+ * @return true if the frame shows an error code (other channels are not filtered)
  */
-void I2CCrealityPiDryer::handle_pv_error(uint8_t pv, uint8_t high_byte, uint8_t low_byte) {
-    // Check if error code is displayed (pv == 225 means "E" on display)
-    if (pv == 225) {
-        // Mask decimal point bit (0x10) for accurate comparison
-        uint8_t high = high_byte & 0xEF;
+bool I2CCrealityPiDryer::handle_pv_error(uint8_t pv, uint8_t high_byte, uint8_t low_byte) {
+    uint8_t code = 0;
+    PvReading reading = Decoder::classify_pv(pv, high_byte, low_byte, code);
+    if (reading == PvReading::ERROR_CODE) {
+        uint8_t events = error_state_.on_error_frame(code, packet_time_, filter_config_);
+        
+        // Channel candidates collected before the error are dropped once per episode
+        if (events & ErrorFilter::NEW_CANDIDATE) reset_filters();
         
-        // Verify high digit is 'E' (letter E corresponds to DIGITS[10])
-        if (high == (DIGITS[10] & 0xEF)) {
-            // Find low digit (error number)
-            for (uint8_t i = 0; i < DIG_COUNT; i++) {
-                if ((low_byte & 0xEF) == (DIGITS[i] & 0xEF)) {
-                    // Format error code string
-                    char error_code[4];
-                    snprintf(error_code, sizeof(error_code), "E%d", i);
-                    
-                    // Filter: check if matches candidate
-                    if (strcmp(error_code, error_state_.candidate_error) == 0) {
-                        error_state_.error_count++;
-                        error_state_.clear_count = 0;  // Reset clear counter
-                        reset_filters();
-                        // If error repeated enough times, confirm and publish
-                        if (error_state_.error_count >= error_state_.min_error_repeats) {
-                            if (!error_state_.error_active || 
-                                strcmp(error_code, error_state_.last_error) != 0) {
-                                
-                                // Publish error to sensor
-                                if (error_status_sensor_) {
-                                    error_status_sensor_->publish_state(error_code);
-                                }
-                                // Clear temperature sensor during error
-                                if (current_temp_sensor_) {
-                                    current_temp_sensor_->publish_state(NAN);
-                                }
-                                
-                                strncpy(error_state_.last_error, error_code, sizeof(error_state_.last_error));
-                                error_state_.error_active = true;
-                                
-                                ESP_LOGW(TAG, "Error confirmed: %s (after %d repeats)", 
-                                         error_code, error_state_.error_count);
-                                
-                                // Update device state to ERROR
-                                handle_device_state_change(DeviceState::ERROR);
-                            }
-                            error_state_.error_count = 0;  // Reset after publishing
-                        }
-                    } else {
-                        // New error candidate detected
-                        strncpy(error_state_.candidate_error, error_code, sizeof(error_state_.candidate_error));
-                        error_state_.error_count = 1;
-                        error_state_.clear_count = 0;
-                    }
-                    return;
-                }
+        if (events & ErrorFilter::CONFIRMED) {
+            // Publish error to sensor
+#ifdef USE_CREALITY_DRYER_ERROR_STATUS
+            if (error_status_sensor_) {
+                error_status_sensor_->publish_state(ERROR_NAMES[code]);
             }
+#endif
+            // Clear temperature sensor during error
+#ifdef USE_CREALITY_DRYER_CURRENT_TEMP
+            if (current_temp_sensor_) {
+                current_temp_sensor_->publish_state(NAN);
+            }
+#endif
+            snapshot_.current_temp = 255;
+            snapshot_.error = ERROR_NAMES[code];
+            mark_changed();
             
-            // Unrecognized error pattern - likely noise
-            ESP_LOGD(TAG, "Unrecognized error pattern: high=0x%02X low=0x%02X", high_byte, low_byte);
-        }
-    } else {
-        // Normal PV value (not error)
-        if (error_state_.error_active) {
-            // Increment normal reading counter
-            error_state_.clear_count++;
-            error_state_.error_count = 0;
+#ifdef USE_CREALITY_DRYER_ERROR_HISTORY
+            // New episode starts at the first frame that showed the code
+            error_history_.begin_episode(code, error_state_.candidate_since, packet_time_);
+            error_history_.add_repeats(error_state_.run_length, packet_time_);
+            publish_error_history();
+#endif
             
-            // If enough consecutive normal readings, clear error
-            if (error_state_.clear_count >= error_state_.min_clear_repeats) {
-                if (error_status_sensor_) {
-                    error_status_sensor_->publish_state("OK");
-                }
-                
-                strncpy(error_state_.last_error, "OK", sizeof(error_state_.last_error));
-                strncpy(error_state_.candidate_error, "OK", sizeof(error_state_.candidate_error));
-                error_state_.error_active = false;
-                error_state_.clear_count = 0;
-                
-                ESP_LOGI(TAG, "Error cleared after %d normal readings", error_state_.min_clear_repeats);
-                
-                // Restore normal device state
-                if (device_state_ == DeviceState::ERROR) {
-                    handle_device_state_change(DeviceState::IDLE);
-                }
-            }
-        } else {
-            // No error, reset counters
-            strncpy(error_state_.candidate_error, "OK", sizeof(error_state_.candidate_error));
-            error_state_.error_count = 0;
-            error_state_.clear_count = 0;
+            ESP_LOGW(TAG, "Error confirmed: %s (after %d repeats)", 
+                     ERROR_NAMES[code], filter_config_.error_confirm_repeats);
+            
+            // Update device state to ERROR
+            handle_device_state_change(DeviceState::ERROR);
+        }
+#ifdef USE_CREALITY_DRYER_ERROR_HISTORY
+        else if (code == error_state_.code) {
+            error_history_.add_repeats(error_state_.run_length, packet_time_);
+        }
+#endif
+        return true;
+    }
+    
+    if (reading == PvReading::UNRECOGNIZED) {
+        // Unrecognized error pattern - likely noise (neither an error nor a normal frame)
+        ESP_LOGD(TAG, "Unrecognized error pattern: high=0x%02X low=0x%02X", high_byte, low_byte);
+#ifdef USE_CREALITY_DRYER_UNKNOWN_PATTERNS
+        uint8_t pattern[2] = {high_byte, low_byte};
+        unknown_patterns_.record(UnknownPatternTable::ERROR_CODE, pattern, 2, packet_time_);
+#endif
+        return false;
+    }
+
+    if (error_state_.on_normal_frame(filter_config_) & ErrorFilter::CLEARED) {
+        // Normal PV value: enough consecutive normal readings clear the error
+#ifdef USE_CREALITY_DRYER_ERROR_STATUS
+        if (error_status_sensor_) {
+            error_status_sensor_->publish_state("OK");
+        }
+#endif
+        snapshot_.error = "OK";
+        mark_changed();
+        
+#ifdef USE_CREALITY_DRYER_ERROR_HISTORY
+        if (error_history_.end_episode(packet_time_)) publish_error_history();
+#endif
+        
+        ESP_LOGI(TAG, "Error cleared after %d normal readings", filter_config_.error_clear_repeats);
+        
+        // Restore normal device state
+        if (device_state_ == DeviceState::ERROR) {
+            handle_device_state_change(DeviceState::IDLE);
         }
     }
+    return false;
 }
 
+#ifdef USE_CREALITY_DRYER_ERROR_HISTORY
+/**
+ * Publish error history sensors (episode boundaries only)
+ */
+void I2CCrealityPiDryer::publish_error_history() {
+    if (error_episodes_sensor_) error_episodes_sensor_->publish_state(error_history_.get_episode_count());
+    for (uint8_t code = 0; code < ERROR_CODE_COUNT; code++) {
+        if (error_code_count_sensors_[code]) {
+            error_code_count_sensors_[code]->publish_state(error_history_.get_code_count(code));
+        }
+    }
+    ErrorEpisode ep;
+    if (last_error_episode_sensor_ && error_history_.get_last(ep)) {
+        char json[128];
+        ErrorHistory::format(ep, millis(), json, sizeof(json));
+        last_error_episode_sensor_->publish_state(json);
+    }
+}
+#endif
+
 // ============================================================================
 // Value Filtering and Publishing
 // ============================================================================
@@ -416,318 +895,403 @@ void I2CCrealityPiDryer::filter_and_publish_values(uint8_t sv, uint8_t pv, uint8
                                                    uint8_t hh, uint8_t mm, uint8_t ss, 
                                                    int mat_idx, const char* cursor, 
                                                    const char* units) {
-    // Set Temperature (with jump protection)
-    if (sv < 225 && sv <= 80) {
-        // Reject jumps > 5°C (likely noise or error)
-        if (set_temp_filter_.initialized && abs((int)sv - (int)set_temp_filter_.last_value) > 5) {
-            // Ignore jump
-        } else {
-            if (sv == set_temp_filter_.candidate) {
-                if (++set_temp_filter_.count >= set_temp_filter_.min_repeats) {
-                    if (!set_temp_filter_.initialized || sv != set_temp_filter_.last_value) {
-                        set_temp_filter_.last_value = sv;
-                        if (set_temp_sensor_) set_temp_sensor_->publish_state((float)sv);
-                        set_temp_filter_.initialized = true;
-                    }
-                    set_temp_filter_.count = 0;
-                }
-            } else {
-                set_temp_filter_.candidate = sv;
-                set_temp_filter_.count = 1;
-            }
-        }
+    // Validity gates, jump handling and repeat counts are the channel rules
+    // of dryer_filter.h (shared with tools/filter_replay.cpp)
+    [[maybe_unused]] const FilterConfig &cfg = filter_config_;
+    [[maybe_unused]] uint32_t now_ms = packet_time_;
+    
+#ifdef CREALITY_DRYER_CURSOR_CONTEXT
+    // Cursor context of the plausibility models (raw cursor, every frame)
+    cursor_context_.update(cursor, now_ms);
+#endif
+    
+#ifdef CREALITY_DRYER_DECODE_SET_TEMP
+    // Set Temperature (changes need the cursor on SV or Material)
+    if (filter_set_temp(set_temp_filter_, sv, cursor_context_, now_ms, cfg)) {
+#ifdef USE_CREALITY_DRYER_SET_TEMP
+        if (set_temp_sensor_) set_temp_sensor_->publish_state((float)sv);
+#endif
+        snapshot_.set_temp = sv;
+        mark_changed();
     }
+#endif
     
-    // Current Temperature (with improved jump protection)
-    if (pv < 225 && pv <= 80 && !error_state_.error_active) {
-        bool is_jump = process_temp_filter_.initialized && 
-                    abs((int)pv - (int)process_temp_filter_.last_value) > 5;
-        
-        
-        if (pv == process_temp_filter_.candidate) {
-            process_temp_filter_.count++;
-        } else {
-            process_temp_filter_.candidate = pv;
-            process_temp_filter_.count = 1;
-        }
-        
-        
-        int required = is_jump ? 10 : process_temp_filter_.min_repeats;
-        
-        if (process_temp_filter_.count >= required) {
-            if (!process_temp_filter_.initialized || pv != process_temp_filter_.last_value) {
-                process_temp_filter_.last_value = pv;
-                if (current_temp_sensor_) current_temp_sensor_->publish_state((float)pv);
-                process_temp_filter_.initialized = true;
-                
-                if (is_jump) {
-                    ESP_LOGI(TAG, "Temperature jump accepted after %d repeats: %d°C", 
-                            process_temp_filter_.count, pv);
-                }
+#ifdef USE_CREALITY_DRYER_CURRENT_TEMP
+    // Current Temperature (jumps accepted after more repeats; held while an error is active)
+    if (!error_state_.active()) {
+        bool is_jump = process_temp_filter_.is_jump(pv, cfg.current_temp_max_jump);
+        if (filter_current_temp(process_temp_filter_, pv, now_ms, cfg)) {
+            if (current_temp_sensor_) current_temp_sensor_->publish_state((float)pv);
+            snapshot_.current_temp = pv;
+            mark_changed();
+            
+            if (is_jump) {
+                ESP_LOGI(TAG, "Temperature jump accepted after %d repeats: %d°C", 
+                        cfg.current_temp_jump_repeats, pv);
             }
-            process_temp_filter_.count = 0;
         }
     }
+#endif
     
-    // Humidity (3 repeats required)
-    if (rh < 225) {
-        if (rh == humidity_filter_.candidate) {
-            if (++humidity_filter_.count >= humidity_filter_.min_repeats) {
-                if (!humidity_filter_.initialized || rh != humidity_filter_.last_value) {
-                    humidity_filter_.last_value = rh;
-                    if (humidity_sensor_) humidity_sensor_->publish_state(rh);
-                    humidity_filter_.initialized = true;
-                }
-                humidity_filter_.count = 0;
-            }
-        } else {
-            humidity_filter_.candidate = rh;
-            humidity_filter_.count = 1;
-        }
+#ifdef CREALITY_DRYER_DECODE_HUMIDITY
+    // Humidity
+    if (filter_humidity(humidity_filter_, rh, cfg)) {
+#ifdef USE_CREALITY_DRYER_HUMIDITY
+        if (humidity_sensor_) humidity_sensor_->publish_state(rh);
+#endif
+        snapshot_.humidity = rh;
+        mark_changed();
     }
+#endif
     
-    // Drying Time (2 repeats required)
-    if (hh < 225 && hh <= 48 && mm < 60 && ss < 60) {
-        uint32_t total_seconds = (uint32_t)hh * 3600 + mm * 60 + ss;
+#ifdef CREALITY_DRYER_DECODE_TIME
+    // Drying Time
+    if (filter_drying_time(time_filter_, hh, mm, ss, cursor_context_, now_ms, cfg)) {
+        uint32_t total_seconds = time_filter_.last_value;
         
-        if (total_seconds == time_filter_.candidate) {
-            if (++time_filter_.count >= time_filter_.min_repeats) {
-                if (!time_filter_.initialized || total_seconds != time_filter_.last_value) {
-                    time_filter_.last_value = total_seconds;
-                    
-                    // Format time string (HH:MM:SS)
-                    char time_str[9];
-                    snprintf(time_str, sizeof(time_str), "%02d:%02d:%02d", hh, mm, ss);
-                    if (drying_time_sensor_) drying_time_sensor_->publish_state(time_str);
-                    
-                    // Update device state based on time (Drying if > 0, Idle if 0)
-                    DeviceState new_state = (total_seconds > 0) ? DeviceState::DRYING : DeviceState::IDLE;
-                    if (device_state_ != DeviceState::ERROR) {
-                        handle_device_state_change(new_state);
-                    }
-                    
-                    // Update dryer status sensor
-                    if (dryer_status_sensor_) {
-                        const char* status = (total_seconds > 0) ? "Drying" : "Idle";
-                        dryer_status_sensor_->publish_state(status);
-                    }
-                    
-                    time_filter_.initialized = true;
-                }
-                time_filter_.count = 0;
-            }
-        } else {
-            time_filter_.candidate = total_seconds;
-            time_filter_.count = 1;
+#ifdef USE_CREALITY_DRYER_DRYING_TIME
+        // Format time string (HH:MM:SS)
+        char time_str[9];
+        snprintf(time_str, sizeof(time_str), "%02d:%02d:%02d", hh, mm, ss);
+        if (drying_time_sensor_) drying_time_sensor_->publish_state(time_str);
+#endif
+        
+        // Update device state based on time (Drying if > 0, Idle if 0)
+        DeviceState new_state = (total_seconds > 0) ? DeviceState::DRYING : DeviceState::IDLE;
+        if (device_state_ != DeviceState::ERROR) {
+            handle_device_state_change(new_state);
+        }
+        
+        // Update dryer status sensor
+#ifdef USE_CREALITY_DRYER_DRYER_STATUS
+        if (dryer_status_sensor_) {
+            const char* status = (total_seconds > 0) ? "Drying" : "Idle";
+            dryer_status_sensor_->publish_state(status);
         }
+#endif
+        snapshot_.drying_time = total_seconds;
+        snapshot_.status = (total_seconds > 0) ? "Drying" : "Idle";
+        mark_changed();
     }
+#endif
     
-    // Material (slow stabilization - 10 repeats required)
-    if (mat_idx >= 0) {
-        if (mat_idx == material_filter_.candidate) {
-            if (++material_filter_.count >= material_filter_.min_repeats) {
-                if (!material_filter_.initialized || mat_idx != material_filter_.last_value) {
-                    material_filter_.last_value = mat_idx;
-                    if (material_sensor_) material_sensor_->publish_state(MATERIAL_NAME[mat_idx]);
-                    material_filter_.initialized = true;
-                }
-                material_filter_.count = 0;
-            }
-        } else {
-            material_filter_.candidate = mat_idx;
-            material_filter_.count = 1;
-        }
+#ifdef CREALITY_DRYER_DECODE_MATERIAL
+    // Material (slow stabilization)
+    if (filter_material(material_filter_, mat_idx, cfg)) {
+#ifdef USE_CREALITY_DRYER_MATERIAL
+        if (material_sensor_) material_sensor_->publish_state(ActiveProtocol::MATERIAL_NAME[mat_idx]);
+#endif
+        snapshot_.material = ActiveProtocol::MATERIAL_NAME[mat_idx];
+        mark_changed();
     }
+#endif
     
-    // Cursor (slow stabilization - 3 repeats required)
-    if (strcmp(cursor, "Unknown") != 0) {
-        if (strcmp(cursor, cursor_filter_.candidate) == 0) {
-            if (++cursor_filter_.count >= cursor_filter_.min_repeats) {
-                if (!cursor_filter_.initialized || strcmp(cursor, cursor_filter_.last_value) != 0) {
-                    cursor_filter_.last_value = cursor;
-                    if (cursor_sensor_) cursor_sensor_->publish_state(cursor);
-                    cursor_filter_.initialized = true;
-                }
-                cursor_filter_.count = 0;
-            }
-        } else {
-            cursor_filter_.candidate = cursor;
-            cursor_filter_.count = 1;
-        }
+#ifdef USE_CREALITY_DRYER_CURSOR
+    // Cursor
+    if (filter_cursor(cursor_filter_, cursor, cfg)) {
+        if (cursor_sensor_) cursor_sensor_->publish_state(cursor);
+        snapshot_.cursor = cursor;
+        mark_changed();
     }
+#endif
     
+#ifdef USE_CREALITY_DRYER_TEMP_UNITS
     // Temperature Units (immediate - publish only on change)
     if (strcmp(units, "Unknown") != 0 && strcmp(units, last_units_) != 0) {
         last_units_ = units;
         if (temp_units_sensor_) temp_units_sensor_->publish_state(units);
+        snapshot_.units = units;
+        mark_changed();
     }
+#endif
 }
 
 // ============================================================================
-// State Management
+// Statistics
 // ============================================================================
 
 /**
- * Handle device state transitions
- * @param new_state New device state to transition to
+ * Record a confirmed channel change
+ * Every publish path calls this once per change so the snapshot and the
+ * publish-rate/time-to-first-publish statistics see the same events.
  */
-void I2CCrealityPiDryer::handle_device_state_change(DeviceState new_state) {
-    if (device_state_ != new_state) {
-        device_state_ = new_state;
+void I2CCrealityPiDryer::mark_changed() {
+    snapshot_pending_ = true;
+    stats_.publishes++;
+    if (first_publish_pending_) {
+        stats_.first_publish_ms = (int32_t)(millis() - power_on_time_);
+        first_publish_pending_ = false;
     }
 }
 
 /**
- * Reset all value filters
- * Called when device reconnects or state changes significantly
+ * Log statistics as a single JSON line
+ * Timings are average nanoseconds per call since boot, process_packet_max_ns
+ * is the worst single frame; publishes are normalized to one minute over the
+ * last reporting window.
  */
-void I2CCrealityPiDryer::reset_filters() {
-    set_temp_filter_.reset();
-    process_temp_filter_.reset();
-    humidity_filter_.reset();
-    time_filter_.reset();
-    material_filter_.reset();
-    cursor_filter_.reset();
-}
-
-/**
- * Reset all state variables
- * Called when device disconnects
- */
-void I2CCrealityPiDryer::reset_all_states() {
-    reset_filters();
-    last_error_state_ = false;
-    last_rh_ = 255;
-    last_units_ = "Unknown";
-    last_cursor_ = "Unknown";
+void I2CCrealityPiDryer::log_statistics() {
+    uint32_t now = millis();
+    uint32_t window_ms = now - last_stats_time_;
+    last_stats_time_ = now;
+    
+    // Cycles to nanoseconds using the actual CPU clock
+    uint32_t cpu_mhz = arch_get_cpu_freq_hz() / 1000000;
+    auto avg_ns = [cpu_mhz](const StageTiming &t) -> uint32_t {
+        return t.samples ? (uint32_t)(t.total_cycles * 1000 / cpu_mhz / t.samples) : 0;
+    };
+    auto max_ns = [cpu_mhz](const StageTiming &t) -> uint32_t {
+        return (uint32_t)((uint64_t)t.max_cycles * 1000 / cpu_mhz);
+    };
+    uint32_t publishes_per_min = window_ms ? (uint32_t)((uint64_t)stats_.publishes * 60000 / window_ms) : 0;
     
-    // Reset error state
-    strncpy(error_state_.last_error, "OK", sizeof(error_state_.last_error));
-    strncpy(error_state_.candidate_error, "OK", sizeof(error_state_.candidate_error));
-    error_state_.error_count = 0;
-    error_state_.clear_count = 0;
-    error_state_.error_active = false;
+    // ISR cost in CPU cycles since boot (copied first: the ISRs keep updating them)
+    IsrCycles scl = capture_.scl_cycles;
+    IsrCycles sda = capture_.sda_cycles;
+    auto min_cycles = [](const IsrCycles &c) -> uint32_t { return c.count ? c.min : 0; };
+    
+    ESP_LOGI(TAG, "stats {\"valid\":%u,\"invalid\":%u,\"salvaged\":%u,\"salvaged_fields\":%u,\"decode_digit_ns\":%u,\"decode_material_idx_ns\":%u,"
+                  "\"filter_and_publish_values_ns\":%u,\"process_packet_ns\":%u,\"process_packet_max_ns\":%u,"
+                  "\"isr_scl_cycles_min\":%u,\"isr_scl_cycles_avg\":%u,\"isr_scl_cycles_max\":%u,"
+                  "\"isr_sda_cycles_min\":%u,\"isr_sda_cycles_avg\":%u,\"isr_sda_cycles_max\":%u,"
+                  "\"publishes_per_min\":%u,\"time_to_first_publish_ms\":%d}",
+             (unsigned)stats_.valid_packets, (unsigned)stats_.invalid_packets,
+             (unsigned)stats_.salvaged_packets, (unsigned)stats_.salvaged_fields,
+             (unsigned)avg_ns(profile_.decode_digit), (unsigned)avg_ns(profile_.decode_material),
+             (unsigned)avg_ns(profile_.filter), (unsigned)avg_ns(profile_.packet),
+             (unsigned)max_ns(profile_.packet),
+             (unsigned)min_cycles(scl), (unsigned)scl.avg(), (unsigned)scl.max,
+             (unsigned)min_cycles(sda), (unsigned)sda.avg(), (unsigned)sda.max,
+             (unsigned)publishes_per_min, (int)stats_.first_publish_ms);
+    stats_.publishes = 0;
 }
 
 // ============================================================================
-// Decoding Functions
+// Aggregated Snapshot
 // ============================================================================
 
 /**
- * Decode 7-segment display digit from two bytes
- * Uses lookup table and Hamming distance for error correction
- * 
- * @param high High byte (tens digit)
- * @param low Low byte (ones digit)
- * @param is_temp Whether this is a temperature value (affects special handling)
- * @return Decoded numeric value (0-99) or special codes: 255=invalid, 225=error
+ * Publish aggregated snapshot as a single JSON document
+ * Only emitted when at least one channel changed during the current frame,
+ * so consumers receive one consistent message per confirmed change set.
+ * Unknown values are serialized as JSON null.
  */
-uint8_t I2CCrealityPiDryer::decode_digit(uint8_t high, uint8_t low, bool is_temp) {
-    // Mask decimal point bit for comparison
-    uint8_t high_m = high & 0xEF;
-    uint8_t low_m = low & 0xEF;
+void I2CCrealityPiDryer::publish_snapshot() {
+    if (!snapshot_pending_) return;
+    snapshot_pending_ = false;
+    // Numbered per change set: several can come from one frame (e.g. the
+    // last values, then power-off), or none from many
+    snapshot_.sequence = ++change_sequence_;
+#ifdef USE_CREALITY_DRYER_SESSIONS
+    // Session boundaries follow the confirmed change sets
+    if (sessions_.update(snapshot_, millis())) publish_session();
+#endif
+    if (!snapshot_sensor_) return;
     
-    uint8_t dh = 255, dl = 255;  // Initialize as invalid
-    
-    // Search for matching digit patterns with error correction
-    for (uint8_t i = 0; i < DIG_COUNT; i++) {
-        uint8_t digit_m = DIGITS[i] & 0xEF;
-        
-        // Check high digit (tens place)
-        if (digit_m == high_m) {
-            dh = i * 10;
-        } else if (dh == 255 && hamming_distance(digit_m, high_m) == 1) {
-            // Allow 1-bit error (error correction)
-            dh = i * 10;
-        }
-        
-        // Check low digit (ones place)
-        if (digit_m == low_m) {
-            dl = i;
-        } else if (dl == 255 && hamming_distance(digit_m, low_m) == 1) {
-            // Allow 1-bit error (error correction)
-            dl = i;
-        }
+    // Numeric fields rendered separately so unknown values become null
+    char set_temp[5], current_temp[5], humidity[5], drying_time[11];
+    auto fmt_u8 = [](char* out, size_t len, uint8_t val) {
+        if (val == 255) snprintf(out, len, "null");
+        else snprintf(out, len, "%u", val);
+    };
+    fmt_u8(set_temp, sizeof(set_temp), snapshot_.set_temp);
+    fmt_u8(current_temp, sizeof(current_temp), snapshot_.current_temp);
+    fmt_u8(humidity, sizeof(humidity), snapshot_.humidity);
+    if (snapshot_.drying_time == UINT32_MAX) {
+        snprintf(drying_time, sizeof(drying_time), "null");
+    } else {
+        snprintf(drying_time, sizeof(drying_time), "\"%02u:%02u:%02u\"",
+                 (unsigned)(snapshot_.drying_time / 3600),
+                 (unsigned)((snapshot_.drying_time / 60) % 60),
+                 (unsigned)(snapshot_.drying_time % 60));
     }
     
-    // Validate decode results
-    if (dh == 255 || dl == 255) return 255;  // Invalid digit
-    if (dh == 100) return 225;  // Letter 'E' detected (error code)
-    if (is_temp && (high & 0x10)) dh += 100;  // Handle temperatures > 99°C
+    // String fields: quoted value or null
+    auto q = [](const char* val) { return val ? "\"" : ""; };
+    auto v = [](const char* val) { return val ? val : "null"; };
     
-    return dh + dl;
+    char json[256];
+    snprintf(json, sizeof(json),
+             "{\"seq\":%u,\"status\":\"%s\",\"set_temp\":%s,\"current_temp\":%s,"
+             "\"humidity\":%s,\"drying_time\":%s,\"material\":%s%s%s,"
+             "\"cursor\":%s%s%s,\"units\":%s%s%s,\"error\":%s%s%s}",
+             (unsigned)snapshot_.sequence, snapshot_.status, set_temp, current_temp,
+             humidity, drying_time,
+             q(snapshot_.material), v(snapshot_.material), q(snapshot_.material),
+             q(snapshot_.cursor), v(snapshot_.cursor), q(snapshot_.cursor),
+             q(snapshot_.units), v(snapshot_.units), q(snapshot_.units),
+             q(snapshot_.error), v(snapshot_.error), q(snapshot_.error));
+    snapshot_sensor_->publish_state(json);
 }
 
+#ifdef USE_CREALITY_DRYER_SESSIONS
 /**
- * Decode material index from XOR checksum
- * Calculates XOR of bytes 8-13 and matches against known material checksums
- * 
- * @param buf Pointer to I2C packet buffer
- * @return Material index (0-11) or -1 if unknown
+ * Publish last finished drying session (JSON) and the session count
  */
-int I2CCrealityPiDryer::decode_material_idx(const volatile uint8_t* buf) {
-    // Calculate XOR checksum from bytes 8-13
-    uint8_t mat_xor = 0;
-    for (int i = 8; i < 14; i++) mat_xor ^= buf[i];
-    
-    // First pass: exact match
-    for (int i = 0; i < 12; i++) {
-        if (mat_xor == MATERIAL_XOR[i]) return i;
+void I2CCrealityPiDryer::publish_session() {
+    SessionRecord rec;
+    if (!sessions_.get_last(rec)) return;
+    if (last_session_sensor_) {
+        char json[256];
+        SessionTracker::format(rec, json, sizeof(json));
+        last_session_sensor_->publish_state(json);
     }
-    
-    // Second pass: allow 1-bit error (error correction)
-    for (int i = 0; i < 12; i++) {
-        if (hamming_distance(mat_xor, MATERIAL_XOR[i]) <= 1) return i;
+    if (session_count_sensor_) session_count_sensor_->publish_state(sessions_.get_count());
+}
+#endif
+
+// ============================================================================
+// Diagnostic Web Endpoints
+// ============================================================================
+
+#ifdef USE_CREALITY_DRYER_WEB
+/**
+ * Claim requests for the component's diagnostic endpoints
+ * All endpoints live under /dryer/ so they cannot clash with web_server
+ */
+bool I2CCrealityPiDryer::canHandle(AsyncWebServerRequest *request) const {
+    return request->url().rfind("/dryer/", 0) == 0;
+}
+
+/**
+ * Serve diagnostic endpoints
+ * /dryer/display            - segment-level text rendering of the LCD
+ * /dryer/unknown            - unrecognized field patterns (JSON)
+ * /dryer/sessions           - drying session history, newest first (JSON)
+ * /dryer/errors             - error counters and episode history (JSON)
+ * /dryer/bus[?since=N]      - logged I2C transactions, optionally from number N on (JSON)
+ * /dryer/recording          - recorder summary (JSON)
+ * /dryer/recording?sector=N - N-th oldest recorder sector (binary)
+ */
+void I2CCrealityPiDryer::handleRequest(AsyncWebServerRequest *request) {
+    std::string url = request->url();
+#ifdef USE_CREALITY_DRYER_DISPLAY_MIRROR
+    if (url == "/dryer/display") {
+        std::string body;
+        display_mirror_.render(body);
+        request->send(200, "text/plain", body.c_str());
+        return;
     }
-    
-    return -1;  // Unknown material
+#endif
+#ifdef USE_CREALITY_DRYER_UNKNOWN_PATTERNS
+    if (url == "/dryer/unknown") {
+        std::string body;
+        unknown_patterns_.render(body);
+        request->send(200, "application/json", body.c_str());
+        return;
+    }
+#endif
+#ifdef USE_CREALITY_DRYER_SESSIONS
+    if (url == "/dryer/sessions") {
+        std::string body;
+        sessions_.render(body);
+        request->send(200, "application/json", body.c_str());
+        return;
+    }
+#endif
+#ifdef USE_CREALITY_DRYER_ERROR_HISTORY
+    if (url == "/dryer/errors") {
+        std::string body;
+        error_history_.render(body, millis());
+        request->send(200, "application/json", body.c_str());
+        return;
+    }
+#endif
+#ifdef USE_CREALITY_DRYER_BUS_LOGGER
+    if (url == "/dryer/bus") {
+        uint32_t since = request->hasArg("since") ? strtoul(request->arg("since").c_str(), nullptr, 10) : 0;
+        std::string body;
+        bus_logger_.render(body, since);
+        request->send(200, "application/json", body.c_str());
+        return;
+    }
+#endif
+#ifdef USE_CREALITY_DRYER_RECORDER
+    if (url == "/dryer/recording") {
+        if (!request->hasArg("sector")) {
+            char info[128];
+            snprintf(info, sizeof(info), "{\"partition\":\"%s\",\"sectors\":%u,\"used\":%u,\"sector_size\":%u}",
+                     recorder_.get_partition_label(), (unsigned)recorder_.get_sector_count(),
+                     (unsigned)recorder_.get_used_sectors(), (unsigned)FrameRecorder::SECTOR_SIZE);
+            request->send(200, "application/json", info);
+            return;
+        }
+        // One sector per request keeps the heap buffer at a single erase unit; the
+        // esp-idf web server sends the response before send() returns, so the
+        // buffer outlives it (the recorder is rejected on Arduino, see __init__.py)
+        uint32_t index = strtoul(request->arg("sector").c_str(), nullptr, 10);
+        std::unique_ptr<uint8_t[]> sector(new uint8_t[FrameRecorder::SECTOR_SIZE]);
+        if (!recorder_.read_sector(index, sector.get())) {
+            request->send(404, "text/plain", "No such sector");
+            return;
+        }
+        request->send(request->beginResponse_P(200, "application/octet-stream", sector.get(),
+                                               FrameRecorder::SECTOR_SIZE));
+        return;
+    }
+#endif
+    request->send(404, "text/plain", "Not found");
 }
+#endif
+
+// ============================================================================
+// State Management
+// ============================================================================
 
 /**
- * Get cursor position name from byte value
- * Determines which menu item is currently selected
- * 
- * @param val Cursor state byte
- * @return Cursor position string ("Idle", "Time", "Material", "SV", "PV")
- */
-const char* I2CCrealityPiDryer::get_cursor_name(uint8_t val) {
-    uint8_t cur = val & 0x8E;  // Mask relevant bits
-    if (cur == 0x00) return "Idle";
-    if (cur == 0x02) return "Time";
-    if (cur == 0x04) return "Material";
-    if (cur == 0x08) return "SV";
-    if (cur == 0x80) return "PV";
-    return "Unknown";
+ * Handle device state transitions
+ * @param new_state New device state to transition to
+ */
+void I2CCrealityPiDryer::handle_device_state_change(DeviceState new_state) {
+    if (device_state_ != new_state) {
+        device_state_ = new_state;
+    }
 }
 
 /**
- * Get temperature units from byte value
- * 
- * @param val Units byte
- * @return Units string ("C" for Celsius, "F" for Fahrenheit)
+ * Reset all value filters
+ * Called when device reconnects or state changes significantly
  */
-const char* I2CCrealityPiDryer::get_units(uint8_t val) {
-    if (val == 0xE5) return "C";
-    if (val == 0xEA) return "F";
-    return "Unknown";
+void I2CCrealityPiDryer::reset_filters() {
+#ifdef CREALITY_DRYER_DECODE_SET_TEMP
+    set_temp_filter_.reset();
+#endif
+#ifdef USE_CREALITY_DRYER_CURRENT_TEMP
+    process_temp_filter_.reset();
+#endif
+#ifdef CREALITY_DRYER_DECODE_HUMIDITY
+    humidity_filter_.reset();
+#endif
+#ifdef CREALITY_DRYER_DECODE_TIME
+    time_filter_.reset();
+#endif
+#ifdef CREALITY_DRYER_DECODE_MATERIAL
+    material_filter_.reset();
+#endif
+#ifdef USE_CREALITY_DRYER_CURSOR
+    cursor_filter_.reset();
+#endif
+#ifdef CREALITY_DRYER_CURSOR_CONTEXT
+    cursor_context_ = CursorContext{};
+#endif
 }
 
 /**
- * Calculate Hamming distance between two bytes
- * Counts number of differing bits (used for error correction)
- * 
- * @param a First byte
- * @param b Second byte
- * @return Number of bits that differ (0-8)
- */
-uint8_t I2CCrealityPiDryer::hamming_distance(uint8_t a, uint8_t b) {
-    uint8_t xor_val = a ^ b;
-    uint8_t count = 0;
-    while (xor_val) {
-        count += xor_val & 1;
-        xor_val >>= 1;
-    }
-    return count;
+ * Reset all state variables
+ * Called when device disconnects
+ */
+void I2CCrealityPiDryer::reset_all_states() {
+    reset_filters();
+    last_error_state_ = false;
+    last_rh_ = 255;
+    last_units_ = "Unknown";
+    last_cursor_ = "Unknown";
+    
+    // Reset error state (an episode still open ends with the power-off)
+#ifdef USE_CREALITY_DRYER_ERROR_HISTORY
+    if (error_history_.end_episode(millis())) publish_error_history();
+#endif
+    error_state_ = ErrorFilter{};
 }
 
 /**
@@ -736,10 +1300,84 @@ uint8_t I2CCrealityPiDryer::hamming_distance(uint8_t a, uint8_t b) {
  */
 void I2CCrealityPiDryer::dump_config() {
     ESP_LOGCONFIG(TAG, "I2C Creality Pi Dryer:");
+    ESP_LOGCONFIG(TAG, "  Model: %s", ActiveProtocol::NAME);
     ESP_LOGCONFIG(TAG, "  SCL Pin: GPIO%d", scl_pin_);
     ESP_LOGCONFIG(TAG, "  SDA Pin: GPIO%d", sda_pin_);
     ESP_LOGCONFIG(TAG, "  Pullup: %s", enable_pullup_ ? "enabled" : "disabled");
     ESP_LOGCONFIG(TAG, "  Statistics: %s", enable_statistics_ ? "enabled" : "disabled");
+#ifdef USE_CREALITY_DRYER_FAST_ISR
+    ESP_LOGCONFIG(TAG, "  ISR: register-level fast path");
+#else
+    ESP_LOGCONFIG(TAG, "  ISR: GPIO driver");
+#endif
+    ESP_LOGCONFIG(TAG, "  Snapshot: %s", snapshot_sensor_ ? "enabled" : "disabled");
+#ifdef USE_CREALITY_DRYER_TELEMETRY
+    ESP_LOGCONFIG(TAG, "  Telemetry: enabled");
+#else
+    ESP_LOGCONFIG(TAG, "  Telemetry: disabled");
+#endif
+    ESP_LOGCONFIG(TAG, "  Power-off detection: %u frame periods of bus silence (min %u ms, fallback %u ms)",
+                  (unsigned)PowerDetector::SILENCE_FRAMES, (unsigned)PowerDetector::MIN_SILENCE_MS,
+                  (unsigned)PowerDetector::DEVICE_TIMEOUT_MS);
+#ifdef USE_CREALITY_DRYER_ERROR_HISTORY
+    ESP_LOGCONFIG(TAG, "  Error history: last %u episodes", (unsigned)ErrorHistory::HISTORY_SIZE);
+#endif
+#ifdef USE_CREALITY_DRYER_SESSIONS
+    ESP_LOGCONFIG(TAG, "  Sessions: %u recorded (last %u kept)", (unsigned)sessions_.get_count(),
+                  (unsigned)SessionTracker::HISTORY_SIZE);
+#endif
+#ifdef USE_CREALITY_DRYER_DISPLAY_MIRROR
+    ESP_LOGCONFIG(TAG, "  Display mirror: /dryer/display");
+#endif
+#ifdef USE_CREALITY_DRYER_UNKNOWN_PATTERNS
+    ESP_LOGCONFIG(TAG, "  Unknown patterns: /dryer/unknown (%u entries)", (unsigned)UnknownPatternTable::CAPACITY);
+#endif
+#ifdef USE_CREALITY_DRYER_BUS_LOGGER
+    ESP_LOGCONFIG(TAG, "  Bus logger: /dryer/bus (%u transactions, %s)", (unsigned)BusLogger::RING_SIZE,
+                  bus_logger_.is_filtered() ? "address filter" : "all addresses");
+#endif
+#ifdef USE_CREALITY_DRYER_IDLE
+#ifdef USE_CREALITY_DRYER_LIGHT_SLEEP
+    ESP_LOGCONFIG(TAG, "  Low-power idle: after %u ms off, light sleep", (unsigned)idle_.get_enter_delay_ms());
+#else
+    ESP_LOGCONFIG(TAG, "  Low-power idle: after %u ms off", (unsigned)idle_.get_enter_delay_ms());
+#endif
+#endif
+#ifdef USE_CREALITY_DRYER_RECORDER
+    ESP_LOGCONFIG(TAG, "  Recorder: %s (partition '%s', %u sectors)",
+                  recorder_.is_enabled() ? "enabled" : "unavailable",
+                  recorder_.get_partition_label(), (unsigned)recorder_.get_sector_count());
+#endif
+    
+    // Channels compiled into this build and resulting component RAM footprint
+#ifdef USE_CREALITY_DRYER_SET_TEMP
+    ESP_LOGCONFIG(TAG, "  Channel: set_temp");
+#endif
+#ifdef USE_CREALITY_DRYER_CURRENT_TEMP
+    ESP_LOGCONFIG(TAG, "  Channel: current_temp");
+#endif
+#ifdef USE_CREALITY_DRYER_HUMIDITY
+    ESP_LOGCONFIG(TAG, "  Channel: humidity");
+#endif
+#ifdef USE_CREALITY_DRYER_DRYING_TIME
+    ESP_LOGCONFIG(TAG, "  Channel: drying_time");
+#endif
+#ifdef USE_CREALITY_DRYER_MATERIAL
+    ESP_LOGCONFIG(TAG, "  Channel: material");
+#endif
+#ifdef USE_CREALITY_DRYER_CURSOR
+    ESP_LOGCONFIG(TAG, "  Channel: cursor");
+#endif
+#ifdef USE_CREALITY_DRYER_TEMP_UNITS
+    ESP_LOGCONFIG(TAG, "  Channel: temp_units");
+#endif
+#ifdef USE_CREALITY_DRYER_ERROR_STATUS
+    ESP_LOGCONFIG(TAG, "  Channel: error_status");
+#endif
+#ifdef USE_CREALITY_DRYER_DRYER_STATUS
+    ESP_LOGCONFIG(TAG, "  Channel: dryer_status");
+#endif
+    ESP_LOGCONFIG(TAG, "  Component RAM: %u bytes", (unsigned)sizeof(*this));
 }
 
 }  // namespace i2c_creality_pi_dryer
@@ -1,8 +1,26 @@
 #pragma once
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
 #include "esphome/core/hal.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/text_sensor/text_sensor.h"
+#include "dryer_protocol.h"
+#include "dryer_capture.h"
+#include "dryer_display.h"
+#include "dryer_recorder.h"
+#include "dryer_unknown.h"
+#include "dryer_session.h"
+#include "dryer_errors.h"
+#include "dryer_filter.h"
+#include "dryer_bus_logger.h"
+#include "dryer_idle.h"
+#include "dryer_power.h"
+#ifdef USE_CREALITY_DRYER_TELEMETRY
+#include "dryer_telemetry.h"
+#endif
+#ifdef USE_CREALITY_DRYER_WEB
+#include "esphome/components/web_server_base/web_server_base.h"
+#endif
 #include <functional>
 
 namespace esphome {
@@ -11,6 +29,33 @@ namespace i2c_creality_pi_dryer {
 // Logging tag for ESP log system
 static const char *const TAG = "i2c_creality_pi_dryer";
 
+// Compile-time channel selection
+// Python codegen emits USE_CREALITY_DRYER_<CHANNEL> for every configured sensor;
+// decode, filter state and publish code of absent channels is compiled out.
+// Drying time is decoded when the time or status sensor or session tracking needs it.
+#if defined(USE_CREALITY_DRYER_DRYING_TIME) || defined(USE_CREALITY_DRYER_DRYER_STATUS) || \
+    defined(USE_CREALITY_DRYER_SESSIONS)
+#define CREALITY_DRYER_DECODE_TIME
+#endif
+// Session records carry set temperature, humidity and material, so session
+// tracking decodes them even without their sensors.
+#if defined(USE_CREALITY_DRYER_SET_TEMP) || defined(USE_CREALITY_DRYER_SESSIONS)
+#define CREALITY_DRYER_DECODE_SET_TEMP
+#endif
+#if defined(USE_CREALITY_DRYER_HUMIDITY) || defined(USE_CREALITY_DRYER_SESSIONS)
+#define CREALITY_DRYER_DECODE_HUMIDITY
+#endif
+#if defined(USE_CREALITY_DRYER_MATERIAL) || defined(USE_CREALITY_DRYER_SESSIONS)
+#define CREALITY_DRYER_DECODE_MATERIAL
+#endif
+// The cursor is also decoded as context for the set temperature and time plausibility models.
+#if defined(CREALITY_DRYER_DECODE_SET_TEMP) || defined(CREALITY_DRYER_DECODE_TIME)
+#define CREALITY_DRYER_CURSOR_CONTEXT
+#endif
+#if defined(USE_CREALITY_DRYER_CURSOR) || defined(CREALITY_DRYER_CURSOR_CONTEXT)
+#define CREALITY_DRYER_DECODE_CURSOR
+#endif
+
 /**
  * Device operational states
  * Tracks the current state of the dryer device
@@ -24,75 +69,23 @@ enum class DeviceState : uint8_t {
 };
 
 /**
- * I2C communication status
- * Tracks the current state of I2C packet reception
- */
-enum class I2CStatus : uint8_t {
-    READY = 0,      // Ready to receive new data
-    RECEIVING = 1,  // Currently receiving I2C packet
-    STOP = 2,       // Stop condition detected, packet complete
-    BUSY = 3        // Processing received packet
-};
-
-/**
- * Template structure for filtered sensor values
- * Implements debouncing by requiring multiple consecutive identical readings
- * before publishing to prevent noise and false readings
- * 
- * Template parameter T: The data type being filtered (uint8_t, int, const char*, etc.)
+ * Aggregated dryer snapshot
+ * Mirrors the last value published to every channel so that consumers can
+ * receive one consistent message per confirmed change set instead of up to
+ * nine separate entity updates. Fields are ordered largest-first to keep the
+ * structure compact without relying on packed (unaligned) access.
  */
-template<typename T>
-struct FilteredValue {
-    T last_value;           // Last published/confirmed value
-    T candidate;            // Current candidate value being evaluated
-    uint8_t count = 0;      // Number of consecutive times candidate has been seen
-    uint8_t min_repeats;    // Required consecutive matches before publishing
-    bool initialized = false; // Whether any value has been published yet
-
-    // Constructor
-    FilteredValue(T initial, uint8_t repeats) : last_value(initial), candidate(initial), min_repeats(repeats) {}
-
-    /**
-     * Update filter with new value and potentially publish
-     * 
-     * @param new_val New value to evaluate
-     * @param publisher Function to call when value is confirmed (publishes to sensor)
-     * @param validator Optional validation function to check if value is valid
-     * @return true if value was published, false otherwise
-     */
-    bool update(const T& new_val, std::function<void(T)> publisher, 
-                std::function<bool(T)> validator = nullptr) {
-        // Validate the new value if validator provided
-        if (validator && !validator(new_val)) return false;
-        
-        if (new_val == candidate) {
-            // Same value as candidate - increment count
-            if (++count >= min_repeats) {
-                // Reached required repetitions
-                if (!initialized || new_val != last_value) {
-                    last_value = new_val;
-                    publisher(new_val);
-                    initialized = true;
-                }
-                count = 0;  // Reset count after publishing
-                return true;
-            }
-        } else {
-            // New different value - reset with new candidate
-            candidate = new_val;
-            count = 1;
-        }
-        return false;
-    }
-
-    /**
-     * Reset filter state
-     * Used when device state changes or connection is lost
-     */
-    void reset() {
-        count = 0;
-        initialized = false;
-    }
+struct DryerSnapshot {
+    uint32_t sequence = 0;                  // Change set number (one per published snapshot)
+    uint32_t drying_time = UINT32_MAX;      // Remaining time in seconds (UINT32_MAX = unknown)
+    const char* material = nullptr;         // Material name (nullptr = unknown)
+    const char* cursor = nullptr;           // Cursor position (nullptr = unknown)
+    const char* units = nullptr;            // Temperature units (nullptr = unknown)
+    const char* error = nullptr;            // Error code or "OK" (nullptr = unknown)
+    const char* status = "Off";             // Dryer operational status
+    uint8_t set_temp = 255;                 // Target temperature (255 = unknown)
+    uint8_t current_temp = 255;             // Current temperature (255 = unknown)
+    uint8_t humidity = 255;                 // Relative humidity (255 = unknown)
 };
 
 /**
@@ -100,7 +93,11 @@ struct FilteredValue {
  * Monitors I2C communication between dryer display and mainboard
  * Extracts and publishes sensor data to Home Assistant
  */
-class I2CCrealityPiDryer : public Component {
+class I2CCrealityPiDryer : public Component
+#ifdef USE_CREALITY_DRYER_WEB
+    , public AsyncWebHandler
+#endif
+{
  public:
   // ESPHome component lifecycle methods
   void setup() override;                              // Initialize component
@@ -109,94 +106,219 @@ class I2CCrealityPiDryer : public Component {
   float get_setup_priority() const override { return setup_priority::LATE; }  // Setup after I2C
 
   // Sensor setter methods (called during component initialization)
+#ifdef USE_CREALITY_DRYER_SET_TEMP
   void set_set_temp_sensor(sensor::Sensor *sensor) { set_temp_sensor_ = sensor; }
+#endif
+#ifdef USE_CREALITY_DRYER_CURRENT_TEMP
   void set_current_temp_sensor(sensor::Sensor *sensor) { current_temp_sensor_ = sensor; }
+#endif
+#ifdef USE_CREALITY_DRYER_HUMIDITY
   void set_humidity_sensor(sensor::Sensor *sensor) { humidity_sensor_ = sensor; }
+#endif
+#ifdef USE_CREALITY_DRYER_DRYING_TIME
   void set_drying_time_sensor(text_sensor::TextSensor *sensor) { drying_time_sensor_ = sensor; }
+#endif
+#ifdef USE_CREALITY_DRYER_MATERIAL
   void set_material_sensor(text_sensor::TextSensor *sensor) { material_sensor_ = sensor; }
+#endif
+#ifdef USE_CREALITY_DRYER_CURSOR
   void set_cursor_sensor(text_sensor::TextSensor *sensor) { cursor_sensor_ = sensor; }
+#endif
+#ifdef USE_CREALITY_DRYER_TEMP_UNITS
   void set_temp_units_sensor(text_sensor::TextSensor *sensor) { temp_units_sensor_ = sensor; }
+#endif
+#ifdef USE_CREALITY_DRYER_ERROR_STATUS
   void set_error_status_sensor(text_sensor::TextSensor *sensor) { error_status_sensor_ = sensor; }
+#endif
+#ifdef USE_CREALITY_DRYER_DRYER_STATUS
   void set_dryer_status_sensor(text_sensor::TextSensor *sensor) { dryer_status_sensor_ = sensor; }
+#endif
+  void set_snapshot_sensor(text_sensor::TextSensor *sensor) { snapshot_sensor_ = sensor; }
 
   // Configuration setter methods
   void set_scl_pin(uint8_t pin) { scl_pin_ = pin; }
   void set_sda_pin(uint8_t pin) { sda_pin_ = pin; }
   void set_enable_pullup(bool enable) { enable_pullup_ = enable; }
   void set_enable_statistics(bool enable) { enable_statistics_ = enable; }
+  void set_filter_repeats(uint8_t set_temp, uint8_t current_temp, uint8_t humidity, uint8_t drying_time,
+                          uint8_t material, uint8_t cursor) {
+    filter_config_.set_temp_repeats = set_temp;
+    filter_config_.current_temp_repeats = current_temp;
+    filter_config_.humidity_repeats = humidity;
+    filter_config_.drying_time_repeats = drying_time;
+    filter_config_.material_repeats = material;
+    filter_config_.cursor_repeats = cursor;
+  }
+  void set_filter_jumps(uint8_t set_temp_max_jump, uint8_t current_temp_max_jump, uint8_t current_temp_jump_repeats) {
+    filter_config_.set_temp_max_jump = set_temp_max_jump;
+    filter_config_.current_temp_max_jump = current_temp_max_jump;
+    filter_config_.current_temp_jump_repeats = current_temp_jump_repeats;
+  }
+  void set_error_repeats(uint8_t confirm, uint8_t clear) {
+    filter_config_.error_confirm_repeats = confirm;
+    filter_config_.error_clear_repeats = clear;
+  }
+  void set_filter_models(bool enable, uint8_t set_temp_plausible, uint8_t current_temp_plausible,
+                         uint8_t drying_time_plausible, uint8_t implausible, uint8_t current_temp_max_rate,
+                         uint8_t drying_time_tolerance) {
+    filter_config_.plausibility = enable;
+    filter_config_.set_temp_plausible_repeats = set_temp_plausible;
+    filter_config_.current_temp_plausible_repeats = current_temp_plausible;
+    filter_config_.drying_time_plausible_repeats = drying_time_plausible;
+    filter_config_.implausible_repeats = implausible;
+    filter_config_.current_temp_max_rate = current_temp_max_rate;
+    filter_config_.drying_time_tolerance = drying_time_tolerance;
+  }
+#ifdef USE_CREALITY_DRYER_TELEMETRY
+  void set_telemetry(const char *host, uint16_t port, uint8_t batch_size) {
+    telemetry_.configure(host, port, batch_size);
+  }
+#endif
+#ifdef USE_CREALITY_DRYER_SESSIONS
+  void set_last_session_sensor(text_sensor::TextSensor *sensor) { last_session_sensor_ = sensor; }
+  void set_session_count_sensor(sensor::Sensor *sensor) { session_count_sensor_ = sensor; }
+#endif
+#ifdef USE_CREALITY_DRYER_ERROR_HISTORY
+  void set_error_episodes_sensor(sensor::Sensor *sensor) { error_episodes_sensor_ = sensor; }
+  void set_last_error_episode_sensor(text_sensor::TextSensor *sensor) { last_error_episode_sensor_ = sensor; }
+  void set_error_code_count_sensor(uint8_t code, sensor::Sensor *sensor) { error_code_count_sensors_[code] = sensor; }
+#endif
+#ifdef USE_CREALITY_DRYER_BUS_LOGGER
+  void add_bus_logger_address(uint8_t address) { bus_logger_.add_address(address); }
+#endif
+#ifdef USE_CREALITY_DRYER_IDLE
+  void set_idle_enter_delay(uint32_t delay_ms) { idle_.set_enter_delay_ms(delay_ms); }
+#endif
+#ifdef USE_CREALITY_DRYER_RECORDER
+  void set_recorder_partition(const char *label) { recorder_.set_partition_label(label); }
+#endif
+#ifdef USE_CREALITY_DRYER_WEB
+  void set_web_server_base(web_server_base::WebServerBase *base) { web_server_base_ = base; }
+
+  // Diagnostic HTTP endpoints under /dryer/ (served by web_server)
+  bool canHandle(AsyncWebServerRequest *request) const override;
+  void handleRequest(AsyncWebServerRequest *request) override;
+#endif
 
   // Public members for ISR (Interrupt Service Routine) access
-  // These must be volatile as they are modified in interrupt context
-  volatile uint8_t buffer_[32];                       // I2C packet receive buffer
-  volatile uint8_t byte_num_{0};                      // Current byte position in buffer
-  volatile uint8_t bit_num_{0};                       // Current bit position in byte
-  volatile uint8_t byte_tmp_{0};                      // Temporary byte being assembled
-  volatile uint8_t i2c_status_{static_cast<uint8_t>(I2CStatus::READY)};  // Current I2C state
-  volatile uint32_t last_edge_time_{0};               // Timestamp of last I2C edge (for timeout)
-  volatile bool wait_ack_{false};                     // Waiting for ACK bit flag
+  // Capture state is static (DRAM) so the ISRs address it directly; last_edge
+  // holds micros(), or CPU cycles with the fast ISR path
+  static CaptureState capture_;                       // Frame buffer and bus state machine
   uint8_t scl_pin_;                                   // SCL GPIO pin number
   uint8_t sda_pin_;                                   // SDA GPIO pin number
+#ifdef USE_CREALITY_DRYER_BUS_LOGGER
+  BusLogger bus_logger_;                              // I2C transaction log (served at /dryer/bus)
+#endif
+#ifdef USE_CREALITY_DRYER_IDLE
+  IdleController idle_;                               // Low-power idle while the dryer is off
+#endif
 
  protected:
   // Timing and protocol constants
   static constexpr uint32_t I2C_TIMEOUT_US = 200;         // I2C timeout in microseconds
-  static constexpr uint32_t DEVICE_TIMEOUT_MS = 3000;     // Device disconnection timeout (3 seconds)
   static constexpr uint32_t LOG_INTERVAL_MS = 30000;      // Debug logging interval (30 seconds)
-  static constexpr uint8_t I2C_DEVICE_ADDRESS = 0x7E;     // Expected I2C device address
-  static constexpr uint8_t BUFFER_SIZE = 32;              // Size of receive buffer
-  static constexpr uint8_t DIG_COUNT = 11;                // Number of digit patterns (0-9 + E)
-  static constexpr uint8_t MATERIAL_COUNT = 12;           // Number of supported materials
-
-  // Static lookup tables for decoding
-  static const uint8_t DIGITS[DIG_COUNT];                 // 7-segment digit bit patterns
-  static const uint8_t MATERIAL_XOR[MATERIAL_COUNT];      // XOR checksums for material identification
-  static const char* MATERIAL_NAME[MATERIAL_COUNT];       // Material name strings
+  // Address, field offsets and lookup tables live in the protocol descriptor
+  // of the selected model (see dryer_protocol.h)
 
   // Configuration flags
   bool enable_pullup_{false};        // Enable internal pull-up resistors on I2C pins
   bool enable_statistics_{true};     // Enable packet statistics tracking
 
   // Sensor pointers (linked during component initialization)
+#ifdef USE_CREALITY_DRYER_SET_TEMP
   sensor::Sensor *set_temp_sensor_{nullptr};              // Target temperature sensor
+#endif
+#ifdef USE_CREALITY_DRYER_CURRENT_TEMP
   sensor::Sensor *current_temp_sensor_{nullptr};          // Current temperature sensor
+#endif
+#ifdef USE_CREALITY_DRYER_HUMIDITY
   sensor::Sensor *humidity_sensor_{nullptr};              // Humidity sensor
+#endif
+#ifdef USE_CREALITY_DRYER_DRYING_TIME
   text_sensor::TextSensor *drying_time_sensor_{nullptr};  // Remaining time text sensor
+#endif
+#ifdef USE_CREALITY_DRYER_MATERIAL
   text_sensor::TextSensor *material_sensor_{nullptr};     // Material type text sensor
+#endif
+#ifdef USE_CREALITY_DRYER_CURSOR
   text_sensor::TextSensor *cursor_sensor_{nullptr};       // Menu cursor position text sensor
+#endif
+#ifdef USE_CREALITY_DRYER_TEMP_UNITS
   text_sensor::TextSensor *temp_units_sensor_{nullptr};   // Temperature units (C/F) text sensor
+#endif
+#ifdef USE_CREALITY_DRYER_ERROR_STATUS
   text_sensor::TextSensor *error_status_sensor_{nullptr}; // Error code text sensor
+#endif
+#ifdef USE_CREALITY_DRYER_DRYER_STATUS
   text_sensor::TextSensor *dryer_status_sensor_{nullptr}; // Dryer status text sensor
+#endif
+  text_sensor::TextSensor *snapshot_sensor_{nullptr};     // Aggregated JSON snapshot text sensor (optional)
 
   // Statistics structure for packet tracking
   struct Statistics {
     uint32_t total_interrupts = 0;   // Total I2C interrupts received
     uint32_t valid_packets = 0;      // Valid packets processed
     uint32_t invalid_packets = 0;    // Invalid/malformed packets rejected
+    uint32_t salvaged_packets = 0;   // Truncated packets decoded field by field
+    uint32_t salvaged_fields = 0;    // Fields decoded from truncated packets
+    uint32_t publishes = 0;          // Confirmed channel changes published (current window)
+    int32_t first_publish_ms = -1;   // Time from power-on to first publish (-1 = not measured)
   };
   Statistics stats_;
 
-  // Value filters (debouncing with configurable repeat counts)
-  FilteredValue<uint8_t> set_temp_filter_{0, 5};          // Set temp: 5 repeats required
-  FilteredValue<uint8_t> process_temp_filter_{0, 5};      // Current temp: 5 repeats required
-  FilteredValue<uint8_t> humidity_filter_{255, 3};        // Humidity: 3 repeats required
-  FilteredValue<uint32_t> time_filter_{0, 2};             // Time: 2 repeats required
-  FilteredValue<int> material_filter_{-1, 10};            // Material: 10 repeats (slow change)
-  FilteredValue<const char*> cursor_filter_{"Unknown", 3}; // Cursor: 3 repeats required
-
   /**
-   * Error state tracking structure
-   * Implements robust error detection with debouncing to prevent false error triggers
+   * Cycle-count accumulator for one processing stage
+   * Filled only when statistics are enabled
    */
-  struct ErrorState {
-    char last_error[4] = "OK";          // Last confirmed error code
-    char candidate_error[4] = "OK";     // Candidate error being evaluated
-    uint8_t error_count = 0;            // Consecutive error readings count
-    uint8_t clear_count = 0;            // Consecutive normal readings count
-    uint8_t min_error_repeats = 3;      // Min repeats to confirm error (prevents false positives)
-    uint8_t min_clear_repeats = 10;      // Min repeats to clear error (prevents flickering)
-    bool error_active = false;          // Whether error is currently active
+  struct StageTiming {
+    uint64_t total_cycles = 0;       // Sum of cycles over all samples
+    uint32_t samples = 0;            // Number of timed calls
+    uint32_t max_cycles = 0;         // Worst single sample
+
+    void add(uint32_t cycles, uint32_t calls = 1) {
+      total_cycles += cycles;
+      samples += calls;
+      if (cycles > max_cycles) max_cycles = cycles;
+    }
   };
-  ErrorState error_state_;
+
+  // Per-stage timings (decode_digit, decode_material_idx, filter_and_publish_values, process_packet)
+  struct Profile {
+    StageTiming decode_digit;
+    StageTiming decode_material;
+    StageTiming filter;
+    StageTiming packet;
+  };
+  Profile profile_;
+  uint32_t power_on_time_{0};        // millis() of the OFF -> STARTING transition
+  bool first_publish_pending_{false};  // Waiting for the first publish after power-on
+
+  // Value filters (debouncing with configurable repeat counts, see dryer_filter.h)
+  FilterConfig filter_config_;                            // Repeat counts and jump thresholds
+#ifdef CREALITY_DRYER_DECODE_SET_TEMP
+  TimedFilteredValue<uint8_t> set_temp_filter_{0};        // Set temp (changes need the cursor on SV)
+#endif
+#ifdef USE_CREALITY_DRYER_CURRENT_TEMP
+  TimedFilteredValue<uint8_t> process_temp_filter_{0};    // Current temp (jumps need more repeats)
+#endif
+#ifdef CREALITY_DRYER_DECODE_HUMIDITY
+  FilteredValue<uint8_t> humidity_filter_{255};           // Humidity
+#endif
+#ifdef CREALITY_DRYER_DECODE_TIME
+  TimedFilteredValue<uint32_t> time_filter_{0};           // Remaining time in seconds (countdown model)
+#endif
+#ifdef CREALITY_DRYER_DECODE_MATERIAL
+  FilteredValue<int> material_filter_{-1};                // Material index (slow change)
+#endif
+#ifdef USE_CREALITY_DRYER_CURSOR
+  FilteredValue<const char*> cursor_filter_{"Unknown"};   // Cursor position
+#endif
+#ifdef CREALITY_DRYER_CURSOR_CONTEXT
+  CursorContext cursor_context_;                          // Fields recently under the cursor
+#endif
+
+  // Error code debouncing (confirm/clear counts from filter_config_)
+  ErrorFilter error_state_;
 
   // Device state tracking
   DeviceState device_state_{DeviceState::OFF};  // Current device operational state
@@ -205,10 +327,50 @@ class I2CCrealityPiDryer : public Component {
   const char* last_units_{"Unknown"};           // Last temperature units (C/F)
   const char* last_cursor_{"Unknown"};          // Last cursor position
 
+  // Aggregated snapshot tracking
+  DryerSnapshot snapshot_;                      // Last published value of every channel
+  uint32_t frame_sequence_{0};                  // Valid frame counter (telemetry, display mirror)
+  uint32_t change_sequence_{0};                 // Change set counter (snapshot sequence number)
+  bool snapshot_pending_{false};                // A channel changed since the last snapshot
+
+#ifdef USE_CREALITY_DRYER_WEB
+  web_server_base::WebServerBase *web_server_base_{nullptr};  // Web server for diagnostic endpoints
+#endif
+#ifdef USE_CREALITY_DRYER_DISPLAY_MIRROR
+  DisplayMirror display_mirror_;     // Segment-level LCD mirror (served at /dryer/display)
+#endif
+#ifdef USE_CREALITY_DRYER_UNKNOWN_PATTERNS
+  UnknownPatternTable unknown_patterns_;  // Unmapped field patterns (served at /dryer/unknown)
+#endif
+#ifdef USE_CREALITY_DRYER_SESSIONS
+  SessionTracker sessions_;          // Drying session history (served at /dryer/sessions)
+  text_sensor::TextSensor *last_session_sensor_{nullptr};  // Last finished session (JSON)
+  sensor::Sensor *session_count_sensor_{nullptr};          // Number of recorded sessions
+#endif
+#ifdef USE_CREALITY_DRYER_ERROR_HISTORY
+  ErrorHistory error_history_;       // Error episodes and per-code counters (served at /dryer/errors)
+  sensor::Sensor *error_episodes_sensor_{nullptr};              // Error episodes since boot
+  text_sensor::TextSensor *last_error_episode_sensor_{nullptr};  // Last error episode (JSON)
+  sensor::Sensor *error_code_count_sensors_[ERROR_CODE_COUNT]{};  // Episodes per code since boot
+#endif
+#ifdef USE_CREALITY_DRYER_TELEMETRY
+  DryerTelemetry telemetry_;         // Binary UDP stream of raw frames (see tools/telemetry_receiver.py)
+#endif
+#ifdef USE_CREALITY_DRYER_RECORDER
+  FrameRecorder recorder_;           // Raw frame flash ring (downloaded at /dryer/recording)
+#endif
+
   // Timing variables
-  uint32_t last_packet_time_{0};    // Timestamp of last valid packet (for timeout detection)
+  uint32_t last_packet_time_{0};    // Timestamp of last complete packet (for timeout detection)
+  uint32_t packet_time_{0};         // Timestamp of the packet being processed (complete or salvaged)
+  PowerDetector power_;             // Frame period and power-off timeouts (see dryer_power.h)
   uint32_t last_log_time_{0};       // Timestamp of last debug log (for periodic logging)
   uint32_t last_yield_time_{0};     // Timestamp of last yield() call (for WiFi/API responsiveness)
+  uint32_t last_stats_time_{0};     // Timestamp of last statistics report
+#ifdef USE_CREALITY_DRYER_FAST_ISR
+  uint32_t last_edge_stamp_{0};     // Last cycle stamp seen from the fast ISRs
+  uint32_t last_edge_us_{0};        // Its conversion to micros()
+#endif
 
   // Validation lambda functions for filtering
   // Temperature validator: < 225 (not error code) and <= 80°C (reasonable range)
@@ -221,9 +383,9 @@ class I2CCrealityPiDryer : public Component {
     return val <= 172800;
   };
   
-  // Material index validator: 0-11 (12 materials supported)
+  // Material index validator: within the model's material table
   std::function<bool(int)> validate_material_ = [](int idx) { 
-    return idx >= 0 && idx < 12; 
+    return idx >= 0 && idx < ActiveProtocol::MATERIAL_COUNT; 
   };
   
   // Cursor validator: not "Unknown"
@@ -240,49 +402,42 @@ class I2CCrealityPiDryer : public Component {
   void handle_timeouts();
   
   /**
-   * Process received I2C packet
-   * Decodes data and updates sensors
+   * micros() of the last bus edge
+   * The fast ISRs stamp edges with the CPU cycle counter, which wraps after
+   * tens of seconds; a stamp is converted once, when it changes, so a long
+   * silence keeps its original time.
    */
-  void process_packet();
+  uint32_t get_last_edge_us();
   
   /**
-   * Decode 7-segment display digit from two bytes
-   * @param high High byte of digit (tens place)
-   * @param low Low byte of digit (ones place)
-   * @param is_temp Whether this is a temperature value (affects decoding)
-   * @return Decoded numeric value or 255 if invalid
+   * Publish the off transition (status first, then cleared channels and snapshot)
    */
-  uint8_t decode_digit(uint8_t high, uint8_t low, bool is_temp = false);
-  
+  void publish_power_off();
+
+#ifdef USE_CREALITY_DRYER_IDLE
   /**
-   * Decode material index from buffer XOR checksum
-   * @param buf Pointer to I2C packet buffer
-   * @return Material index (0-11) or -1 if unknown
+   * Stop the loop while the dryer is off (and allow light sleep)
+   * The SCL ISR stays armed; its first edge re-enables the loop.
    */
-  int decode_material_idx(const volatile uint8_t* buf);
+  void enter_idle();
   
   /**
-   * Get cursor name from byte value
-   * @param val Cursor state byte
-   * @return Cursor name string ("Idle", "Time", "Material", etc.)
+   * Loop is running again after a wake edge: restore full capture
    */
-  const char* get_cursor_name(uint8_t val);
-  
+  void leave_idle();
+#endif
+#ifdef USE_CREALITY_DRYER_LIGHT_SLEEP
   /**
-   * Get temperature units from byte value
-   * @param val Units byte
-   * @return Units string ("C", "F", or "Unknown")
+   * Allow or forbid automatic light sleep (power management at a fixed CPU clock)
    */
-  const char* get_units(uint8_t val);
+  void configure_light_sleep(bool enable);
+#endif
   
   /**
-   * Calculate Hamming distance between two bytes
-   * Used for error correction in digit decoding
-   * @param a First byte
-   * @param b Second byte
-   * @return Number of differing bits
+   * Process received I2C packet
+   * Decodes data and updates sensors
    */
-  uint8_t hamming_distance(uint8_t a, uint8_t b);
+  void process_packet();
   
   /**
    * Handle error code detection and filtering
@@ -290,8 +445,16 @@ class I2CCrealityPiDryer : public Component {
    * @param pv Process value (225 = error indicator)
    * @param high_byte High byte of error code
    * @param low_byte Low byte of error code
+   * @return true if the frame shows an error code
    */
-  void handle_pv_error(uint8_t pv, uint8_t high_byte, uint8_t low_byte);
+  bool handle_pv_error(uint8_t pv, uint8_t high_byte, uint8_t low_byte);
+  
+#ifdef USE_CREALITY_DRYER_ERROR_HISTORY
+  /**
+   * Publish error episode count and last episode (episode boundaries only)
+   */
+  void publish_error_history();
+#endif
   
   /**
    * Filter and publish all sensor values
@@ -311,6 +474,30 @@ class I2CCrealityPiDryer : public Component {
                                  int mat_idx, const char* cursor, 
                                  const char* units);
   
+  /**
+   * Record that a channel published a confirmed change
+   * Marks the aggregated snapshot dirty and feeds publish statistics
+   */
+  void mark_changed();
+  
+  /**
+   * Log statistics as one JSON line (machine-readable, see tools/bench_compare.py)
+   */
+  void log_statistics();
+  
+  /**
+   * Publish aggregated snapshot if any channel changed
+   * Called once at the end of each processed frame and on disconnect
+   */
+  void publish_snapshot();
+  
+#ifdef USE_CREALITY_DRYER_SESSIONS
+  /**
+   * Publish the last stored drying session to the session sensors
+   */
+  void publish_session();
+#endif
+  
   /**
    * Handle device state transitions
    * @param new_state New device state
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""
+Creality Pi Dryer performance comparison
+========================================
+Extracts the JSON statistics lines logged by the i2c_creality_pi_dryer
+component (enable_statistics: true) from ESPHome log captures and compares a
+candidate run against a baseline run.
+
+Usage:
+    # Print the aggregated statistics of one capture as JSON
+    python3 bench_compare.py capture.log
+
+    # Fail (exit code 1) if any timing regressed by more than 10 %
+    python3 bench_compare.py baseline.log candidate.log --threshold 10
+
+Both runs should use the same firmware configuration and a comparable dryer
+activity (e.g. idle, drying, material scrolling) for the numbers to be
+meaningful. A capture is recorded with `esphome logs <config>.yaml > run.log`.
+Decoder and filter changes can be gated without a device by host_bench.py.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+STATS_RE = re.compile(r"stats (\{.*\})")
+
+# Lower is better for every compared metric
+TIMING_KEYS = [
+    "decode_digit_ns",
+    "decode_material_idx_ns",
+    "filter_and_publish_values_ns",
+    "process_packet_ns",
+    "process_packet_max_ns",
+    "isr_scl_cycles_avg",
+    "isr_sda_cycles_avg",
+]
+RATE_KEYS = ["publishes_per_min"]
+
+
+def load(path):
+    """Aggregate all statistics lines of a capture (or a JSON file)"""
+    with open(path, encoding="utf-8", errors="replace") as handle:
+        text = handle.read()
+    if text.lstrip().startswith("{"):
+        return json.loads(text)
+
+    samples = [json.loads(match.group(1)) for match in STATS_RE.finditer(text)]
+    if not samples:
+        raise SystemExit(f"{path}: no statistics lines found (is enable_statistics on?)")
+
+    # Timings are cumulative averages, so the last line is the most accurate;
+    # publish rates are per window, so they are averaged over all windows
+    result = dict(samples[-1])
+    for key in RATE_KEYS:
+        result[key] = sum(sample[key] for sample in samples) / len(samples)
+    result["windows"] = len(samples)
+    return result
+
+
+def compare(baseline, candidate, threshold):
+    """Print a comparison table and return True if nothing regressed"""
+    ok = True
+    print(f"{'metric':32} {'baseline':>10} {'candidate':>10} {'change':>8}")
+    for key in TIMING_KEYS + RATE_KEYS:
+        base = baseline.get(key)
+        cand = candidate.get(key)
+        if base is None or cand is None:
+            continue
+        change = ((cand - base) / base * 100.0) if base else 0.0
+        regressed = key in TIMING_KEYS and change > threshold
+        ok &= not regressed
+        print(f"{key:32} {base:>10.0f} {cand:>10.0f} {change:>+7.1f}%{'  REGRESSION' if regressed else ''}")
+    print(f"{'time_to_first_publish_ms':32} {baseline.get('time_to_first_publish_ms', -1):>10} "
+          f"{candidate.get('time_to_first_publish_ms', -1):>10}")
+    return ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="Baseline log capture or JSON file")
+    parser.add_argument("candidate", nargs="?", help="Candidate log capture or JSON file")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="Allowed timing regression in percent (default: 10)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    if args.candidate is None:
+        print(json.dumps(baseline, indent=2))
+        return 0
+
+    candidate = load(args.candidate)
+    return 0 if compare(baseline, candidate, args.threshold) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""
+Creality Pi Dryer benchmark corpus generator
+============================================
+Writes the synthetic "<ms> <hex>" frame files used by tools/host_bench.py,
+one per dryer activity. None of them is a capture of a real dryer: frames
+are built from the protocol tables below, and every file starts with a
+comment line saying so. The output is deterministic (fixed seeds), so the
+committed files can be regenerated bit for bit:
+
+    python3 tools/bench_corpus/generate.py
+
+    idle.txt         dryer on, not drying: a static display
+    drying.txt       countdown, chamber heating towards SV, blinking colon
+    scrolling.txt    material selection: cursor on Material, presets change
+                     material, SV and time about once per second
+    errors.txt       drying interrupted by E-code episodes
+    power_cycle.txt  short on periods separated by power-off gaps
+    noisy_bus.txt    drying with bit flips and repeated corrupted frames
+
+Frame layout must match SpacePiPlusProtocol in dryer_protocol.h.
+"""
+
+import random
+from pathlib import Path
+
+OUT = Path(__file__).resolve().parent
+FRAMES = 1200                # Per file (2 minutes of bus traffic)
+PERIOD_MS = 100              # Frame period of the display controller
+
+ADDRESS = 0x7E
+DIGITS = [0xAF, 0xA0, 0xCB, 0xE9, 0xE4, 0x6D, 0x6F, 0xA8, 0xEF, 0xED, 0x4F]
+DIGIT_E = 10
+COLON_BIT = 0x10             # Decimal point / colon segment (ignored by the decoder)
+MATERIAL_XOR = [0x27, 0x37, 0xEB, 0xFD, 0xE3, 0x19, 0x83, 0xFE, 0xF3, 0x93, 0x97, 0xE1]
+MATERIAL_PLA = 9
+CURSOR_IDLE, CURSOR_TIME, CURSOR_MATERIAL, CURSOR_SV = 0x00, 0x02, 0x04, 0x08
+UNITS_C = 0xE5
+POWER_OFF_GAP_MS = 5000      # Longer than any power-off timeout (PowerDetector, dryer_power.h)
+
+
+def pair(value):
+    return [DIGITS[value // 10], DIGITS[value % 10]]
+
+
+def frame(sv, pv, rh, seconds, material=MATERIAL_PLA, cursor=CURSOR_IDLE, colon=False, error=None):
+    """Raw 22-byte frame; error=n shows 'En' in the PV field"""
+    hh, mm, ss = seconds // 3600, seconds // 60 % 60, seconds % 60
+    pv_field = [DIGITS[DIGIT_E], DIGITS[error]] if error is not None else pair(pv)
+    minutes = pair(mm)
+    if colon:
+        minutes[0] |= COLON_BIT
+    return bytes([ADDRESS, 0x00, cursor] + pair(sv) + pv_field + [UNITS_C] +
+                 [MATERIAL_XOR[material], 0, 0, 0, 0, 0] + pair(rh) + pair(hh) + minutes + pair(ss))
+
+
+def drying(ms, start_pv=25.0, sv=50):
+    """Frame of a drying run ms into it"""
+    pv = min(sv, int(start_pv + ms / 10000))
+    left = max(0, 4 * 3600 - ms // 1000)
+    return frame(sv, pv, 18, left, colon=(ms // 500) % 2 == 1)
+
+
+def idle():
+    for n in range(FRAMES):
+        yield n * PERIOD_MS, frame(50, 24, 41, 4 * 3600)
+
+
+def drying_run():
+    for n in range(FRAMES):
+        yield n * PERIOD_MS, drying(n * PERIOD_MS)
+
+
+def scrolling():
+    rng = random.Random(3)
+    material = MATERIAL_PLA
+    for n in range(FRAMES):
+        if n % 10 == 0:
+            material = rng.randrange(len(MATERIAL_XOR))
+        sv = 40 + 5 * (material % 8)
+        yield n * PERIOD_MS, frame(sv, 24, 41, (4 + material % 8) * 3600, material, CURSOR_MATERIAL)
+
+
+def errors():
+    rng = random.Random(5)
+    code = None
+    for n in range(FRAMES):
+        ms = n * PERIOD_MS
+        if n % 200 == 100:
+            code = rng.choice([1, 3, 5, 7])
+        elif n % 200 == 160:
+            code = None
+        base = drying(ms)
+        if code is None:
+            yield ms, base
+        else:
+            yield ms, base[:5] + bytes([DIGITS[DIGIT_E], DIGITS[code]]) + base[7:]
+
+
+def power_cycle():
+    ms = 0
+    for n in range(FRAMES):
+        if n and n % 150 == 0:
+            ms += POWER_OFF_GAP_MS
+        yield ms, drying((n % 150) * PERIOD_MS)
+        ms += PERIOD_MS
+
+
+def noisy_bus():
+    rng = random.Random(7)
+    ms = 0
+    n = 0
+    while n < FRAMES:
+        data = bytearray(drying(ms))
+        if rng.random() < 0.15:
+            data[rng.randrange(2, len(data))] ^= 1 << rng.randrange(8)
+        if rng.random() < 0.05:
+            data[rng.randrange(3, 7)] = DIGITS[rng.randrange(10)]
+        # A glitching display line repeats the same corrupted frame
+        repeats = rng.randrange(2, 6) if rng.random() < 0.01 else 1
+        for _ in range(min(repeats, FRAMES - n)):
+            yield ms, bytes(data)
+            ms += PERIOD_MS
+            n += 1
+
+
+CORPUS = {
+    "idle": idle,
+    "drying": drying_run,
+    "scrolling": scrolling,
+    "errors": errors,
+    "power_cycle": power_cycle,
+    "noisy_bus": noisy_bus,
+}
+
+
+def main():
+    for name, generate in CORPUS.items():
+        with open(OUT / f"{name}.txt", "w") as handle:
+            handle.write(f"# Synthetic {name} trace written by tools/bench_corpus/generate.py, "
+                         "not captured from a dryer\n")
+            for ms, data in generate():
+                handle.write(f"{ms} {data.hex()}\n")
+
+
+if __name__ == "__main__":
+    main()
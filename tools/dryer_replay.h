@@ -0,0 +1,163 @@
+/**
+ * Creality Pi Dryer host replay pipeline
+ * ======================================
+ * Loads "<ms> <hex>" frame files (also for host_bench.cpp) and, for
+ * filter_replay.cpp, runs frames through the component's own decoder
+ * (dryer_protocol.h) and value filters (dryer_filter.h), mirroring
+ * process_packet() / handle_pv_error() / filter_and_publish_values() with
+ * every channel compiled in.
+ */
+#pragma once
+
+#include "dryer_protocol.h"
+#include "dryer_filter.h"
+#include "dryer_power.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+struct Frame {
+    uint32_t ms;
+    uint8_t bytes[ActiveProtocol::FRAME_SIZE];
+};
+
+/**
+ * Load "<ms> <hex>" lines (recording_tool.py decode --hex)
+ * Lines without exactly FRAME_SIZE hex bytes (e.g. "#" comments) or with a
+ * foreign address are skipped.
+ */
+inline bool load_frames(const char *path, std::vector<Frame> &frames) {
+    FILE *file = fopen(path, "r");
+    if (file == nullptr) return false;
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        Frame frame{};
+        unsigned ms;
+        int used;
+        if (sscanf(line, "%u %n", &ms, &used) != 1) continue;
+        // Hex field must be exactly FRAME_SIZE bytes (independent of the model)
+        const char *hex = line + used;
+        size_t hex_len = strspn(hex, "0123456789abcdefABCDEF");
+        if (hex_len != 2 * ActiveProtocol::FRAME_SIZE) continue;
+        frame.ms = ms;
+        for (uint8_t i = 0; i < ActiveProtocol::FRAME_SIZE; i++) {
+            unsigned byte;
+            sscanf(hex + 2 * i, "%2x", &byte);
+            frame.bytes[i] = byte;
+        }
+        if (frame.bytes[0] == ActiveProtocol::ADDRESS) frames.push_back(frame);
+    }
+    fclose(file);
+    return true;
+}
+
+/**
+ * Filter state of one replay
+ * Sink receives publish(ms, channel, value) with a const char * or unsigned
+ * value for every publish the component would make.
+ */
+template<typename Sink>
+struct Replay {
+    FilterConfig cfg;
+    ErrorFilter error;
+    CursorContext context;
+    TimedFilteredValue<uint8_t> set_temp{0};
+    TimedFilteredValue<uint8_t> current_temp{0};
+    FilteredValue<uint8_t> humidity{255};
+    TimedFilteredValue<uint32_t> drying_time{0};
+    FilteredValue<int> material{-1};
+    FilteredValue<const char *> cursor{"Unknown"};
+    PowerDetector power;
+    Sink sink;
+    uint32_t last_ms{0};
+    bool started{false};
+    bool on{false};                 // Dryer on (a frame since the last power-off)
+
+    void reset_filters() {
+        set_temp.reset();
+        current_temp.reset();
+        humidity.reset();
+        drying_time.reset();
+        material.reset();
+        cursor.reset();
+        context = CursorContext{};
+    }
+
+    /**
+     * Next frame of a trace, with the component's power-cycle handling
+     * The bus is silent between recorded frames, so the gap is both the bus
+     * silence and the time since the last frame for PowerDetector; the frame
+     * period is tracked from the second frame after power-on, as in
+     * process_packet().
+     */
+    void feed(const Frame &f) {
+        if (!started) {
+            // setup() publishes "OK" before the first frame
+            sink.publish(f.ms, "error", "OK");
+            started = true;
+        } else if (on) {
+            uint32_t gap = f.ms - last_ms;
+            bool bus_silent;
+            if (power.is_off(gap, gap, bus_silent)) {
+                // Power cycle: the component resets all filter state
+                reset_filters();
+                error = ErrorFilter{};
+                power.reset();
+            } else {
+                power.on_frame(gap);
+            }
+        }
+        on = true;
+        last_ms = f.ms;
+        frame(f);
+    }
+
+    void frame(const Frame &f) {
+        using P = ActiveProtocol;
+        const uint8_t *b = f.bytes;
+        uint8_t sv = Decoder::decode_digit(b[P::SV_OFFSET], b[P::SV_OFFSET + 1], true);
+        uint8_t pv = Decoder::decode_digit(b[P::PV_OFFSET], b[P::PV_OFFSET + 1], true);
+        uint8_t rh = Decoder::decode_digit(b[P::RH_OFFSET], b[P::RH_OFFSET + 1]);
+        uint8_t hh = Decoder::decode_digit(b[P::HOURS_OFFSET], b[P::HOURS_OFFSET + 1]);
+        uint8_t mm = Decoder::decode_digit(b[P::MINUTES_OFFSET], b[P::MINUTES_OFFSET + 1]);
+        uint8_t ss = Decoder::decode_digit(b[P::SECONDS_OFFSET], b[P::SECONDS_OFFSET + 1]);
+        int mat_idx = Decoder::decode_material_idx(b);
+        const char *cur = Decoder::get_cursor_name(b[P::CURSOR_OFFSET]);
+
+        // Error frames hold the other channels; noise matching 'E' only
+        // after bit correction counts as neither (same rule as the component)
+        uint8_t code = 0;
+        PvReading reading = Decoder::classify_pv(pv, b[P::PV_OFFSET], b[P::PV_OFFSET + 1], code);
+        if (reading == PvReading::ERROR_CODE) {
+            uint8_t events = error.on_error_frame(code, f.ms, cfg);
+            if (events & ErrorFilter::NEW_CANDIDATE) reset_filters();
+            if (events & ErrorFilter::CONFIRMED) {
+                char name[4];
+                snprintf(name, sizeof(name), "E%d", code);
+                sink.publish(f.ms, "error", name);
+            }
+            return;
+        }
+        if (reading == PvReading::VALUE && (error.on_normal_frame(cfg) & ErrorFilter::CLEARED)) {
+            sink.publish(f.ms, "error", "OK");
+        }
+
+        context.update(cur, f.ms);
+        if (filter_set_temp(set_temp, sv, context, f.ms, cfg)) sink.publish(f.ms, "set_temp", sv);
+        if (!error.active() && filter_current_temp(current_temp, pv, f.ms, cfg)) {
+            sink.publish(f.ms, "current_temp", pv);
+        }
+        if (filter_humidity(humidity, rh, cfg)) sink.publish(f.ms, "humidity", rh);
+        if (filter_drying_time(drying_time, hh, mm, ss, context, f.ms, cfg)) {
+            sink.publish(f.ms, "drying_time", drying_time.last_value);
+        }
+        if (filter_material(material, mat_idx, cfg)) sink.publish(f.ms, "material", P::MATERIAL_NAME[mat_idx]);
+        if (filter_cursor(cursor, cur, cfg)) sink.publish(f.ms, "cursor", cur);
+    }
+};
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
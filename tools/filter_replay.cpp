@@ -0,0 +1,90 @@
+/**
+ * Creality Pi Dryer filter replay
+ * ===============================
+ * Host driver for tools/filter_tuner.py: replays recorded frames through the
+ * component's own decoder (dryer_protocol.h) and value filters
+ * (dryer_filter.h), via the pipeline in dryer_replay.h, for any number of
+ * filter configurations and prints every publish the component would make.
+ *
+ * Build (filter_tuner.py does this automatically):
+ *   g++ -std=gnu++17 -O2 -I<stub dir> -I external_components/i2c_creality_pi_dryer \
+ *       tools/filter_replay.cpp -o filter_replay
+ * where <stub dir>/esphome/core/defines.h defines USE_CREALITY_DRYER_MODEL_SPACE_PI_PLUS.
+ *
+ * Usage:
+ *   filter_replay frames.txt < configs.txt
+ *
+ * frames.txt: "<ms> <hex>" lines as printed by `recording_tool.py decode --hex`
+ * configs.txt: one configuration per line, the FilterConfig fields in
+ *              declaration order
+ * Output: "<config> <ms> <channel> <value>" per publish, "<config> end" after
+ *         each configuration
+ */
+
+#include "dryer_replay.h"
+#include <cstdio>
+#include <vector>
+
+using namespace esphome::i2c_creality_pi_dryer;
+
+/**
+ * Prints every publish as "<config> <ms> <channel> <value>"
+ */
+struct PrintSink {
+    int index;
+
+    void publish(uint32_t ms, const char *channel, const char *value) {
+        printf("%d %u %s %s\n", index, (unsigned)ms, channel, value);
+    }
+    void publish(uint32_t ms, const char *channel, unsigned value) {
+        printf("%d %u %s %u\n", index, (unsigned)ms, channel, value);
+    }
+};
+
+static constexpr int CONFIG_FIELDS = 18;
+
+static bool parse_config(const char *line, FilterConfig &cfg) {
+    uint8_t *fields[CONFIG_FIELDS] = {
+        &cfg.set_temp_repeats, &cfg.current_temp_repeats, &cfg.humidity_repeats, &cfg.drying_time_repeats,
+        &cfg.material_repeats, &cfg.cursor_repeats, &cfg.set_temp_max_jump, &cfg.current_temp_max_jump,
+        &cfg.current_temp_jump_repeats, &cfg.error_confirm_repeats, &cfg.error_clear_repeats,
+        &cfg.plausibility, &cfg.set_temp_plausible_repeats, &cfg.current_temp_plausible_repeats,
+        &cfg.drying_time_plausible_repeats, &cfg.implausible_repeats, &cfg.current_temp_max_rate,
+        &cfg.drying_time_tolerance,
+    };
+    for (int i = 0; i < CONFIG_FIELDS; i++) {
+        unsigned value;
+        int used;
+        if (sscanf(line, "%u%n", &value, &used) != 1) return false;
+        *fields[i] = value;
+        line += used;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s frames.txt < configs.txt\n", argv[0]);
+        return 2;
+    }
+    std::vector<Frame> frames;
+    if (!load_frames(argv[1], frames)) {
+        fprintf(stderr, "%s: cannot open\n", argv[1]);
+        return 1;
+    }
+
+    char line[256];
+    int index = 0;
+    while (fgets(line, sizeof(line), stdin)) {
+        Replay<PrintSink> replay;
+        replay.sink.index = index;
+        if (!parse_config(line, replay.cfg)) {
+            fprintf(stderr, "config %d: expected %d values\n", index, CONFIG_FIELDS);
+            return 1;
+        }
+        for (const Frame &frame : frames) replay.feed(frame);
+        printf("%d end\n", index);
+        index++;
+    }
+    return 0;
+}
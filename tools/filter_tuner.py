@@ -0,0 +1,315 @@
+#!/usr/bin/env python3
+"""
+Creality Pi Dryer filter tuner
+==============================
+Sweeps the value filter thresholds of the i2c_creality_pi_dryer component
+(repeat counts, temperature jump thresholds, error confirm/clear counts,
+plausibility model parameters) over labelled recordings and reports, per
+channel, the Pareto frontier of publish latency against bad publishes. The
+default thresholds are first replayed with the plausibility models off and on
+to show what the models change; the models (off by default) are suggested,
+and their parameters swept, only if they are faster without more bad
+publishes. Frames are replayed through the component's
+own decoder and filter code (tools/filter_replay.cpp, built on the fly with
+$CXX or g++), so the numbers match the firmware.
+
+Usage:
+    # Tune over one or more traces and print a `filters:` YAML block
+    python3 filter_tuner.py drying.bin idle.txt
+
+    # Allow one bad publish per channel, 3 s flicker window
+    python3 filter_tuner.py drying.bin --max-bad 1 --flicker-ms 3000
+
+Traces are recordings (`.bin` from `recording_tool.py download`) or their
+`recording_tool.py decode --hex` output. Each trace needs a label file (by
+default `<trace>.labels.jsonl`, or given with --labels in trace order) with
+one JSON object per line stating the value the display really showed from
+`ms` on:
+
+    {"ms": 120500, "channel": "set_temp", "value": 50}
+    {"ms": 121000, "channel": "drying_time", "value": 14400, "countdown": true}
+    {"ms": 130000, "channel": "error", "value": "E3"}
+
+Channels: set_temp, current_temp, humidity, drying_time, material, cursor,
+error ("OK" when no error). A countdown label decreases by one per second
+from `ms` on. Unlabelled channels keep their current values.
+
+Metrics per channel:
+    latency  - mean time from a labelled change to the first correct publish
+               (a change never published counts its whole duration)
+    bad      - publishes that disagree with the label (drying_time within
+               +-2 s) plus flickers: publishes reverted to the previous value
+               within --flicker-ms
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+COMPONENT = ROOT / "external_components" / "i2c_creality_pi_dryer"
+REPLAY_SOURCE = Path(__file__).resolve().parent / "filter_replay.cpp"
+
+# FilterConfig field order (dryer_filter.h) with the component defaults
+DEFAULTS = {
+    "set_temp_repeats": 5,
+    "current_temp_repeats": 5,
+    "humidity_repeats": 3,
+    "drying_time_repeats": 2,
+    "material_repeats": 10,
+    "cursor_repeats": 3,
+    "set_temp_max_jump": 5,
+    "current_temp_max_jump": 5,
+    "current_temp_jump_repeats": 10,
+    "error_confirm_repeats": 3,
+    "error_clear_repeats": 10,
+    "plausibility": 0,
+    "set_temp_plausible_repeats": 2,
+    "current_temp_plausible_repeats": 2,
+    "drying_time_plausible_repeats": 2,
+    "implausible_repeats": 30,
+    "current_temp_max_rate": 10,
+    "drying_time_tolerance": 2,
+}
+# Plausibility models on/off (a boolean in YAML)
+FLAGS = {"plausibility"}
+
+# Parameters swept per channel; the other parameters stay at their defaults
+SWEEPS = {
+    "set_temp": {"set_temp_repeats": range(1, 9), "set_temp_max_jump": [3, 5, 8, 10, 80],
+                 "set_temp_plausible_repeats": range(1, 5)},
+    "current_temp": {"current_temp_repeats": range(1, 9), "current_temp_max_jump": [3, 5, 8],
+                     "current_temp_jump_repeats": [2, 4, 6, 8, 10, 15],
+                     "current_temp_plausible_repeats": range(1, 5), "current_temp_max_rate": [5, 10, 20]},
+    "humidity": {"humidity_repeats": range(1, 9)},
+    "drying_time": {"drying_time_repeats": range(1, 6), "drying_time_plausible_repeats": range(1, 4),
+                    "drying_time_tolerance": [1, 2, 3, 5]},
+    "material": {"material_repeats": range(1, 16)},
+    "cursor": {"cursor_repeats": range(1, 9)},
+    "error": {"error_confirm_repeats": range(1, 7), "error_clear_repeats": [2, 3, 5, 7, 10, 15]},
+}
+
+NUMERIC = {"set_temp", "current_temp", "humidity", "drying_time"}
+TIME_TOLERANCE_S = 2
+
+
+def build_replay(workdir):
+    """Compile filter_replay.cpp against the component headers"""
+    stub = Path(workdir) / "esphome" / "core"
+    stub.mkdir(parents=True)
+    (stub / "defines.h").write_text("#pragma once\n#define USE_CREALITY_DRYER_MODEL_SPACE_PI_PLUS\n")
+    binary = Path(workdir) / "filter_replay"
+    compiler = os.environ.get("CXX", "g++")
+    subprocess.run([compiler, "-std=gnu++17", "-O2", f"-I{workdir}", f"-I{COMPONENT}",
+                    str(REPLAY_SOURCE), "-o", str(binary)], check=True)
+    return binary
+
+
+def frames_file(trace, workdir):
+    """Frame lines for the replay; recordings are decoded with recording_tool"""
+    if not trace.endswith(".bin"):
+        return trace
+    sys.path.insert(0, str(Path(__file__).resolve().parent))
+    import recording_tool
+    out = Path(workdir) / (Path(trace).stem + ".txt")
+    with open(out, "w") as handle:
+        for timestamp, frame in recording_tool.read_recording(trace):
+            handle.write(f"{timestamp} {frame.hex()}\n")
+    return str(out)
+
+
+def load_labels(path):
+    """Per-channel list of (ms, value, countdown), sorted by time"""
+    labels = {}
+    with open(path) as handle:
+        for line in handle:
+            if line.strip():
+                entry = json.loads(line)
+                labels.setdefault(entry["channel"], []).append(
+                    (entry["ms"], entry["value"], bool(entry.get("countdown"))))
+    for entries in labels.values():
+        entries.sort(key=lambda entry: entry[0])
+    return labels
+
+
+def replay(binary, frames, configs):
+    """Run all configurations over one trace; returns per-config publish lists"""
+    stdin = "".join(" ".join(str(cfg[key]) for key in DEFAULTS) + "\n" for cfg in configs)
+    result = subprocess.run([str(binary), frames], input=stdin, capture_output=True, text=True, check=True)
+    publishes = [[] for _ in configs]
+    for line in result.stdout.splitlines():
+        parts = line.split(" ", 3)
+        if len(parts) == 4:
+            publishes[int(parts[0])].append((int(parts[1]), parts[2], parts[3]))
+    return publishes
+
+
+def truth_at(entries, ms):
+    """Labelled value at ms (None before the first label)"""
+    current = None
+    for start, value, countdown in entries:
+        if start > ms:
+            break
+        current = (start, value, countdown)
+    if current is None:
+        return None
+    start, value, countdown = current
+    return max(0, value - (ms - start) // 1000) if countdown else value
+
+
+def matches(channel, published, truth):
+    if channel == "drying_time":
+        return abs(int(published) - int(truth)) <= TIME_TOLERANCE_S
+    if channel in NUMERIC:
+        return int(published) == int(truth)
+    return published == str(truth)
+
+
+def score(channel, publishes, entries, end_ms, flicker_ms):
+    """(latency sum ms, labelled changes, bad publishes) of one channel in one trace"""
+    events = [(ms, value) for ms, name, value in publishes if name == channel]
+    bad = set()
+
+    # Flickers: A -> B -> A within the window
+    for i in range(2, len(events)):
+        if events[i][1] == events[i - 2][1] and events[i][0] - events[i - 1][0] <= flicker_ms:
+            bad.add(i - 1)
+    if not entries:
+        return 0, 0, len(bad)
+
+    # Publishes contradicting the label
+    for i, (ms, value) in enumerate(events):
+        truth = truth_at(entries, ms)
+        if truth is not None and not matches(channel, value, truth):
+            bad.add(i)
+
+    # Latency per labelled change (a countdown is one change at its start)
+    latency = 0
+    changes = 0
+    previous = None
+    for index, (start, value, countdown) in enumerate(entries):
+        stop = entries[index + 1][0] if index + 1 < len(entries) else end_ms
+        if value == previous and not countdown:
+            continue
+        previous = value
+        changes += 1
+        hit = next((ms for ms, published in events
+                    if start <= ms < stop and matches(channel, published, truth_at(entries, ms))), None)
+        latency += (hit - start) if hit is not None else (stop - start)
+    return latency, changes, len(bad)
+
+
+def evaluate(binary, traces, channel, configs, flicker_ms):
+    """Per-configuration latency (mean ms per labelled change) and bad publishes of one channel"""
+    points = [{"cfg": cfg, "latency": 0, "changes": 0, "bad": 0} for cfg in configs]
+    for frames, labels, end_ms in traces:
+        for point, publishes in zip(points, replay(binary, frames, configs)):
+            latency, changes, bad = score(channel, publishes, labels.get(channel, []), end_ms, flicker_ms)
+            point["latency"] += latency
+            point["changes"] += changes
+            point["bad"] += bad
+    for point in points:
+        point["latency"] = point["latency"] / point["changes"] if point["changes"] else 0.0
+    return points
+
+
+def compare_models(binary, traces, flicker_ms):
+    """
+    Default thresholds with the plausibility models off and on
+    Returns 1 (models on) if they are faster over all channels without more
+    bad publishes, else 0
+    """
+    configs = [dict(DEFAULTS, plausibility=0), dict(DEFAULTS, plausibility=1)]
+    print("Plausibility models at default thresholds")
+    print(f"  {'channel':<14} {'latency ms off':>14} {'on':>8} {'bad off':>8} {'on':>5}")
+    totals = {"off": [0.0, 0], "on": [0.0, 0]}
+    for channel in SWEEPS:
+        off, on = evaluate(binary, traces, channel, configs, flicker_ms)
+        print(f"  {channel:<14} {off['latency']:>14.0f} {on['latency']:>8.0f} {off['bad']:>8} {on['bad']:>5}")
+        for key, point in (("off", off), ("on", on)):
+            totals[key][0] += point["latency"]
+            totals[key][1] += point["bad"]
+    return int(totals["on"][1] <= totals["off"][1] and totals["on"][0] < totals["off"][0])
+
+
+def sweep_configs(channel, base):
+    configs = [dict(base)]
+    for key, values in SWEEPS[channel].items():
+        configs = [dict(cfg, **{key: value}) for cfg in configs for value in values]
+    # Jump repeats below the normal repeats would make jumps easier than steps
+    return [cfg for cfg in configs
+            if cfg["current_temp_jump_repeats"] >= cfg["current_temp_repeats"]]
+
+
+def pareto(points):
+    """Non-dominated (latency, bad) points, sorted by latency"""
+    frontier = []
+    for point in sorted(points, key=lambda p: (p["latency"], p["bad"])):
+        if not frontier or point["bad"] < frontier[-1]["bad"]:
+            frontier.append(point)
+    return frontier
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("traces", nargs="+", help="Recordings (.bin) or decoded '<ms> <hex>' frame files")
+    parser.add_argument("--labels", nargs="+", help="Label files in trace order (default: <trace>.labels.jsonl)")
+    parser.add_argument("--flicker-ms", type=int, default=5000, help="Revert window counted as flicker")
+    parser.add_argument("--max-bad", type=int, default=0, help="Bad publishes tolerated per channel")
+    args = parser.parse_args()
+
+    label_paths = args.labels or [str(Path(t).with_suffix("")) + ".labels.jsonl" for t in args.traces]
+    if len(label_paths) != len(args.traces):
+        raise SystemExit("--labels needs one file per trace")
+
+    chosen = dict(DEFAULTS)
+    with tempfile.TemporaryDirectory() as workdir:
+        binary = build_replay(workdir)
+        traces = []
+        for trace, label_path in zip(args.traces, label_paths):
+            frames = frames_file(trace, workdir)
+            with open(frames) as handle:
+                stamps = [int(line.split()[0]) for line in handle if line.strip() and not line.startswith("#")]
+            labels = load_labels(label_path) if os.path.exists(label_path) else {}
+            if not labels:
+                print(f"{trace}: no labels, only flicker is scored", file=sys.stderr)
+            traces.append((frames, labels, stamps[-1] if stamps else 0))
+
+        # Model parameters are swept (and suggested) only with the models on
+        chosen["plausibility"] = compare_models(binary, traces, args.flicker_ms)
+
+        for channel in SWEEPS:
+            configs = sweep_configs(channel, chosen)
+            points = evaluate(binary, traces, channel, configs, args.flicker_ms)
+
+            frontier = pareto(points)
+            print(f"\n{channel}: {len(configs)} configurations, Pareto frontier")
+            print(f"  {'latency ms':>10} {'bad':>5}  parameters")
+            for point in frontier:
+                params = " ".join(f"{key}={point['cfg'][key]}" for key in SWEEPS[channel])
+                print(f"  {point['latency']:>10.0f} {point['bad']:>5}  {params}")
+
+            # Fastest setting within the bad-publish budget (else the cleanest one)
+            if not any(point["changes"] for point in points):
+                print("  no labelled changes, keeping defaults")
+                continue
+            acceptable = [point for point in frontier if point["bad"] <= args.max_bad]
+            best = acceptable[0] if acceptable else frontier[-1]
+            for key in SWEEPS[channel]:
+                chosen[key] = best["cfg"][key]
+
+    print("\n# Suggested filter thresholds")
+    print("i2c_creality_pi_dryer:")
+    print("  filters:")
+    for key, value in chosen.items():
+        shown = ("true" if value else "false") if key in FLAGS else value
+        print(f"    {key}: {shown}{'' if value != DEFAULTS[key] else '  # default'}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,182 @@
+/**
+ * Creality Pi Dryer host benchmark
+ * ================================
+ * Host driver for tools/host_bench.py: replays frame files through the real
+ * component (i2c_creality_pi_dryer.cpp via host_tests/host_dryer.h, every
+ * sensor channel configured) in simulated time and reports the component's
+ * own stage profile, publish rate and time to first publish.
+ *
+ * Build (host_bench.py does this automatically):
+ *   g++ -std=gnu++17 -O2 -I tools/host_tests -I tools/host_tests/stubs \
+ *       -I external_components/i2c_creality_pi_dryer tools/host_bench.cpp -o host_bench
+ *
+ * Usage:
+ *   host_bench [--passes N] [--repeats R] frames.txt...
+ *
+ * Every file is replayed N times per measurement and measured R times; the
+ * fastest measurement of every stage is reported (the least disturbed by the
+ * host). Output: one JSON object per file with
+ *   frames                         complete frames processed
+ *   decode_digit_ns                ns per frame in decode_digit() (all digit pairs)
+ *   decode_material_idx_ns         ns per frame in decode_material_idx()
+ *   filter_and_publish_values_ns   ns per frame in filter_and_publish_values()
+ *   process_packet_ns              ns per frame in process_packet() (all of the above)
+ *   publishes                      confirmed channel changes of one replay
+ *   publishes_per_min              the same per minute of trace time
+ *   time_to_first_publish_ms       power-on (first frame after silence) to the
+ *                                  first publish, averaged over power-ons
+ *                                  (-1 = nothing published); as on the device,
+ *                                  temperature units count, which are
+ *                                  published from the first frame on
+ * Stage times are the component's cycle counts (StageTiming), which the host
+ * stubs run at one cycle per nanosecond.
+ */
+
+// Every sensor channel, as with the full example configuration
+#define USE_CREALITY_DRYER_SET_TEMP
+#define USE_CREALITY_DRYER_CURRENT_TEMP
+#define USE_CREALITY_DRYER_HUMIDITY
+#define USE_CREALITY_DRYER_DRYING_TIME
+#define USE_CREALITY_DRYER_MATERIAL
+#define USE_CREALITY_DRYER_CURSOR
+#define USE_CREALITY_DRYER_TEMP_UNITS
+#define USE_CREALITY_DRYER_ERROR_STATUS
+#define USE_CREALITY_DRYER_DRYER_STATUS
+
+#include "host_dryer.h"
+#include "dryer_replay.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::i2c_creality_pi_dryer;
+
+/**
+ * Component under test with every sensor attached
+ */
+struct BenchDryer : HostDryer {
+    sensor::Sensor set_temp, current_temp, humidity;
+    text_sensor::TextSensor drying_time, material, cursor, units, error, status;
+
+    using HostDryer::first_publish_pending_;
+
+    BenchDryer() {
+        set_set_temp_sensor(&set_temp);
+        set_current_temp_sensor(&current_temp);
+        set_humidity_sensor(&humidity);
+        set_drying_time_sensor(&drying_time);
+        set_material_sensor(&material);
+        set_cursor_sensor(&cursor);
+        set_temp_units_sensor(&units);
+        set_error_status_sensor(&error);
+        set_dryer_status_sensor(&status);
+        // Stage profiling without the periodic report, which restarts the publish count
+        set_enable_statistics(false);
+    }
+};
+
+/**
+ * Results of one or more replays of a file
+ */
+struct Result {
+    uint64_t stage_cycles[4]{};     // decode_digit, decode_material_idx, filter_and_publish_values, process_packet
+    uint64_t frames{0};             // Timed (complete) frames
+    uint32_t publishes{0};          // Of the last replay
+    int64_t ttfp_total_ms{0};       // Sum of the times to first publish
+    uint32_t power_ons{0};          // Power-ons that reached a first publish
+
+    double stage_ns(int stage) const { return frames ? (double) stage_cycles[stage] / frames : 0.0; }
+};
+
+/**
+ * Replay one file through a fresh component
+ */
+static void replay(const std::vector<Frame> &frames, Result &result) {
+    host_millis = frames.front().ms;
+    BenchDryer dryer;
+    dryer.setup();
+    HostDryer::capture_.profile = true;
+
+    bool armed = false;
+    for (const Frame &frame : frames) {
+        // A power-on arms the first publish measurement (possibly resolved by
+        // the same frame), the first publish resolves it; a power-off before
+        // any publish leaves first_publish_ms at -1
+        bool was_off = dryer.device_state_ == DeviceState::OFF;
+        if (was_off) dryer.stats_.first_publish_ms = -1;
+        dryer.feed(frame.ms, frame.bytes, sizeof(frame.bytes));
+        if (was_off && dryer.device_state_ != DeviceState::OFF) armed = true;
+        if (armed && !dryer.first_publish_pending_) {
+            armed = false;
+            if (dryer.stats_.first_publish_ms >= 0) {
+                result.ttfp_total_ms += dryer.stats_.first_publish_ms;
+                result.power_ons++;
+            }
+        }
+    }
+
+    const auto &profile = dryer.profile_;
+    result.stage_cycles[0] += profile.decode_digit.total_cycles;
+    result.stage_cycles[1] += profile.decode_material.total_cycles;
+    result.stage_cycles[2] += profile.filter.total_cycles;
+    result.stage_cycles[3] += profile.packet.total_cycles;
+    result.frames += profile.packet.samples;
+    result.publishes = dryer.stats_.publishes;
+}
+
+int main(int argc, char **argv) {
+    int passes = 5, repeats = 20;
+    int first = 1;
+    while (first + 1 < argc && argv[first][0] == '-') {
+        if (strcmp(argv[first], "--passes") == 0) {
+            passes = atoi(argv[first + 1]);
+        } else if (strcmp(argv[first], "--repeats") == 0) {
+            repeats = atoi(argv[first + 1]);
+        } else {
+            break;
+        }
+        first += 2;
+    }
+    if (first >= argc || passes <= 0 || repeats <= 0) {
+        fprintf(stderr, "usage: %s [--passes N] [--repeats R] frames.txt...\n", argv[0]);
+        return 2;
+    }
+
+    static const char *const STAGES[4] = {"decode_digit_ns", "decode_material_idx_ns",
+                                          "filter_and_publish_values_ns", "process_packet_ns"};
+    for (int i = first; i < argc; i++) {
+        std::vector<Frame> frames;
+        if (!load_frames(argv[i], frames)) {
+            fprintf(stderr, "%s: cannot open\n", argv[i]);
+            return 1;
+        }
+        if (frames.empty()) {
+            fprintf(stderr, "%s: no frames\n", argv[i]);
+            return 1;
+        }
+
+        // Warm-up replay (caches, branch predictors) also yields the publish figures
+        Result first_replay;
+        replay(frames, first_replay);
+
+        double best[4] = {};
+        for (int r = 0; r < repeats; r++) {
+            Result measured;
+            for (int p = 0; p < passes; p++) replay(frames, measured);
+            for (int stage = 0; stage < 4; stage++) {
+                if (r == 0 || measured.stage_ns(stage) < best[stage]) best[stage] = measured.stage_ns(stage);
+            }
+        }
+
+        uint32_t span_ms = frames.back().ms - frames.front().ms;
+        double per_min = span_ms ? first_replay.publishes * 60000.0 / span_ms : 0.0;
+        double ttfp = first_replay.power_ons ? (double) first_replay.ttfp_total_ms / first_replay.power_ons : -1.0;
+        printf("{\"file\":\"%s\",\"frames\":%u", argv[i], (unsigned) first_replay.frames);
+        for (int stage = 0; stage < 4; stage++) printf(",\"%s\":%.1f", STAGES[stage], best[stage]);
+        printf(",\"publishes\":%u,\"publishes_per_min\":%.1f,\"time_to_first_publish_ms\":%.0f}\n",
+               (unsigned) first_replay.publishes, per_min, ttfp);
+    }
+    return 0;
+}
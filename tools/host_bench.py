@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+"""
+Creality Pi Dryer host benchmark
+================================
+Replays frame files through the real component on the host and reports,
+per file, the component's own stage profile in ns per frame
+(decode_digit, decode_material_idx, filter_and_publish_values,
+process_packet), publishes per minute of trace time and the time from
+power-on to the first publish. The component sources are compiled into
+tools/host_bench.cpp (through host_tests/host_dryer.h and the host stubs)
+on the fly with $CXX or g++, so no dryer or ESP32 is needed.
+
+The default corpus in tools/bench_corpus/ (idle, drying, material
+scrolling, E-errors, power cycles, noisy bus) is synthetic: written by
+bench_corpus/generate.py, not captured from a dryer. Recorded traces
+(recording_tool.py decode --hex) can be passed as files instead.
+
+Results are printed as JSON on stdout, tables and comparisons on stderr.
+
+Usage:
+    # Time the working tree
+    python3 host_bench.py
+
+    # Gate: fail (exit code 1) if the working tree is more than 20 % slower
+    # than commit REV on any corpus file
+    python3 host_bench.py --against HEAD --threshold 20
+
+    # Or compare against results saved earlier on the same machine
+    python3 host_bench.py --save before.json
+    python3 host_bench.py --baseline before.json
+
+With --against, both builds run on the same machine in alternating rounds;
+each round yields a candidate/reference ratio per file and metric, and the
+median ratio over the rounds is gated. Pairing adjacent runs cancels slow
+phases of a busy host, which a comparison of absolute times does not.
+The reference is built from REV's component sources with the current
+tools/host_bench.cpp, harness and stubs, so REV must provide the members the
+harness uses (stage profile, statistics). Saved results are only comparable
+on the machine that produced them.
+"""
+
+import argparse
+import json
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+COMPONENT = ROOT / "external_components" / "i2c_creality_pi_dryer"
+BENCH_SOURCE = Path(__file__).resolve().parent / "host_bench.cpp"
+HOST_TESTS = Path(__file__).resolve().parent / "host_tests"    # host_dryer.h harness
+STUBS = HOST_TESTS / "stubs"
+CORPUS = Path(__file__).resolve().parent / "bench_corpus"
+
+# Timed stages, ns per frame (lower is better)
+METRICS = ["decode_digit_ns", "decode_material_idx_ns", "filter_and_publish_values_ns", "process_packet_ns"]
+# Behaviour, not speed: a change means the timings compare different work
+BEHAVIOUR = ["publishes", "publishes_per_min", "time_to_first_publish_ms"]
+
+
+def build_bench(workdir, component, name):
+    """Compile host_bench.cpp against the component sources in `component`"""
+    binary = Path(workdir) / name
+    compiler = os.environ.get("CXX", "g++")
+    subprocess.run([compiler, "-std=gnu++17", "-O2", f"-I{HOST_TESTS}", f"-I{STUBS}", f"-I{component}",
+                    str(BENCH_SOURCE), "-o", str(binary)], check=True)
+    return binary
+
+
+def checkout_component(workdir, rev):
+    """Extract the component directory of commit `rev`"""
+    target = Path(workdir) / "ref"
+    target.mkdir()
+    relative = COMPONENT.relative_to(ROOT).as_posix()
+    archive = subprocess.run(["git", "-C", str(ROOT), "archive", rev, relative],
+                             capture_output=True, check=True).stdout
+    subprocess.run(["tar", "-x", "-C", str(target)], input=archive, check=True)
+    return target / relative
+
+
+def run(binary, files, passes, repeats):
+    """Per-file results of one benchmark run"""
+    result = subprocess.run([str(binary), "--passes", str(passes), "--repeats", str(repeats)] +
+                            [str(f) for f in files], capture_output=True, text=True, check=True)
+    results = {}
+    for line in result.stdout.splitlines():
+        values = json.loads(line)
+        results[Path(values.pop("file")).stem] = values
+    return results
+
+
+def fastest(runs):
+    """Per-file minimum of every metric over several runs"""
+    merged = {}
+    for results in runs:
+        for name, values in results.items():
+            if name not in merged:
+                merged[name] = dict(values)
+                continue
+            for key in METRICS:
+                merged[name][key] = min(merged[name][key], values[key])
+    return merged
+
+
+def report(results):
+    print(f"{'corpus':14} {'frames':>7} {'digit':>7} {'material':>9} {'filter':>7} {'packet':>7} "
+          f"{'pub/min':>8} {'ttfp ms':>8}", file=sys.stderr)
+    for name, values in results.items():
+        print(f"{name:14} {values['frames']:>7} {values['decode_digit_ns']:>7.1f} "
+              f"{values['decode_material_idx_ns']:>9.1f} {values['filter_and_publish_values_ns']:>7.1f} "
+              f"{values['process_packet_ns']:>7.1f} {values['publishes_per_min']:>8.1f} "
+              f"{values['time_to_first_publish_ms']:>8}", file=sys.stderr)
+    print("(stage times in ns per frame)", file=sys.stderr)
+
+
+def paired_ratios(reference_runs, candidate_runs):
+    """Median candidate/reference ratio per file and metric over the rounds"""
+    ratios = {}
+    for reference, candidate in zip(reference_runs, candidate_runs):
+        for name, values in candidate.items():
+            base = reference.get(name)
+            if base is None:
+                continue
+            for key in METRICS:
+                if base[key]:
+                    ratios.setdefault(name, {}).setdefault(key, []).append(values[key] / base[key])
+    return {name: {key: statistics.median(values) for key, values in metrics.items()}
+            for name, metrics in ratios.items()}
+
+
+def compare(baseline, candidate, threshold, ratios=None):
+    """Print per-file changes and return True if nothing regressed
+
+    The change is the median paired ratio when given (--against), else the
+    ratio of the two (fastest) times.
+    """
+    ok = True
+    print(f"{'corpus':14} {'metric':28} {'baseline':>10} {'candidate':>10} {'change':>8}", file=sys.stderr)
+    for name, values in candidate.items():
+        base = baseline.get(name)
+        if base is None:
+            print(f"{name:14} (not in baseline)", file=sys.stderr)
+            continue
+        for key in METRICS:
+            if ratios is not None and key in ratios.get(name, {}):
+                change = (ratios[name][key] - 1.0) * 100.0
+            else:
+                change = (values[key] - base[key]) / base[key] * 100.0 if base[key] else 0.0
+            regressed = change > threshold
+            ok &= not regressed
+            print(f"{name:14} {key:28} {base[key]:>10.1f} {values[key]:>10.1f} {change:>+7.1f}%"
+                  f"{'  REGRESSION' if regressed else ''}", file=sys.stderr)
+        for key in BEHAVIOUR:
+            if base.get(key) != values[key]:
+                # Not a slowdown, but the timings compare different work
+                print(f"{name:14} {key} changed: {base.get(key)} -> {values[key]}", file=sys.stderr)
+    return ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("files", nargs="*", help="Frame files (default: tools/bench_corpus/*.txt)")
+    parser.add_argument("--against", metavar="REV", help="Compare against the component at git revision REV")
+    parser.add_argument("--baseline", help="Compare against results saved with --save")
+    parser.add_argument("--save", help="Also write the results as JSON to a file")
+    parser.add_argument("--threshold", type=float, default=20.0, help="Allowed slowdown in percent")
+    parser.add_argument("--rounds", type=int, default=5, help="Runs per build")
+    parser.add_argument("--passes", type=int, default=5, help="Replays of a file per measurement")
+    parser.add_argument("--repeats", type=int, default=20, help="Measurements per file and run")
+    args = parser.parse_args()
+
+    files = args.files or sorted(CORPUS.glob("*.txt"))
+    if not files:
+        raise SystemExit("no frame files")
+
+    with tempfile.TemporaryDirectory() as workdir:
+        candidate_bin = build_bench(workdir, COMPONENT, "host_bench")
+        reference_bin = None
+        if args.against:
+            reference_bin = build_bench(workdir, checkout_component(workdir, args.against), "host_bench_ref")
+
+        candidate_runs, reference_runs = [], []
+        for _ in range(args.rounds):
+            # Alternate the builds so slow phases of the host hit both
+            if reference_bin:
+                reference_runs.append(run(reference_bin, files, args.passes, args.repeats))
+            candidate_runs.append(run(candidate_bin, files, args.passes, args.repeats))
+
+    candidate = fastest(candidate_runs)
+    report(candidate)
+    print(json.dumps(candidate, indent=2))
+    if args.save:
+        with open(args.save, "w") as handle:
+            json.dump(candidate, handle, indent=2)
+
+    baseline = ratios = None
+    if reference_bin:
+        baseline = fastest(reference_runs)
+        ratios = paired_ratios(reference_runs, candidate_runs)
+    elif args.baseline:
+        with open(args.baseline) as handle:
+            baseline = json.load(handle)
+    if baseline is None:
+        return 0
+
+    print(file=sys.stderr)
+    if not compare(baseline, candidate, args.threshold, ratios):
+        print(f"\nslower than the baseline by more than {args.threshold:.0f} %", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""
+Creality Pi Dryer host tests
+============================
+Builds and runs the host tests in tools/host_tests/ (test_*.cpp) against the
+component's ESPHome-free code (capture state machine, transaction logger,
+idle controller, frame recorder, decoder, filters) and, through
+host_tests/host_dryer.h, the whole component fed with simulated frames, with
+$CXX or g++. The ESPHome/ESP-IDF/lwIP headers come from host_tests/stubs/
+(simulated clock, flash partition, preferences and sent UDP datagrams kept
+in memory). test_telemetry decodes its datagrams with telemetry_receiver.py,
+so python3 must be on PATH. No dryer or ESP32 is needed.
+
+Usage:
+    # Run every test
+    python3 host_tests.py
+
+    # Run selected tests
+    python3 host_tests.py test_idle
+
+Exit code 1 if any test fails to build or run.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+COMPONENT = ROOT / "external_components" / "i2c_creality_pi_dryer"
+TESTS = Path(__file__).resolve().parent / "host_tests"
+STUBS = TESTS / "stubs"      # ESPHome/ESP-IDF headers the tested code includes
+TOOLS = ROOT / "tools"       # dryer_replay.h, for tests comparing the replay with the component
+
+
+def build_test(workdir, source):
+    """Compile one test against the component headers and the host stubs"""
+    binary = Path(workdir) / source.stem
+    compiler = os.environ.get("CXX", "g++")
+    result = subprocess.run([compiler, "-std=gnu++17", "-O2", "-Wall", "-Wextra", f"-I{STUBS}",
+                             f"-I{COMPONENT}", f"-I{TOOLS}", str(source), "-o", str(binary)],
+                            capture_output=True, text=True)
+    if result.returncode != 0:
+        sys.stderr.write(result.stderr)
+        return None
+    return binary
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("tests", nargs="*", help="Test names (default: all test_*.cpp)")
+    args = parser.parse_args()
+
+    sources = sorted(TESTS.glob("test_*.cpp"))
+    if args.tests:
+        sources = [source for source in sources if source.stem in args.tests]
+        if len(sources) != len(set(args.tests)):
+            raise SystemExit("unknown test; available: " +
+                             ", ".join(source.stem for source in sorted(TESTS.glob("test_*.cpp"))))
+
+    failed = []
+    with tempfile.TemporaryDirectory() as workdir:
+        for source in sources:
+            binary = build_test(workdir, source)
+            ok = binary is not None and subprocess.run([str(binary)]).returncode == 0
+            print(f"{source.stem:24} {'ok' if ok else 'FAILED'}")
+            if not ok:
+                failed.append(source.stem)
+
+    if failed:
+        print(f"\n{len(failed)} of {len(sources)} failed: {', '.join(failed)}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
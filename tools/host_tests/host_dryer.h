@@ -0,0 +1,118 @@
+/**
+ * Host harness for the whole component (i2c_creality_pi_dryer.cpp)
+ * The including file selects the build first with the USE_CREALITY_DRYER_*
+ * defines __init__.py would emit; the component sources are compiled into
+ * the same unit against host_tests/stubs (simulated millis(), in-memory
+ * preferences and flash, sensors that keep their last state).
+ *
+ * HostDryer stands in for the ISRs and the ESPHome main loop: a frame is
+ * left in capture_ the way capture_data() leaves it at STOP, and loop() runs
+ * every LOOP_INTERVAL_MS of simulated time in between, so power-off is
+ * detected from bus silence exactly as on the device.
+ */
+#pragma once
+
+#include "i2c_creality_pi_dryer.cpp"
+#include "dryer_bus_logger.cpp"
+#include "dryer_display.cpp"
+#include "dryer_errors.cpp"
+#include "dryer_recorder.cpp"
+#include "dryer_session.cpp"
+#include "dryer_telemetry.cpp"
+#include "dryer_unknown.cpp"
+
+namespace esphome {
+namespace i2c_creality_pi_dryer {
+
+/**
+ * Display frame for the selected model from field values
+ */
+struct FrameFields {
+    uint8_t set_temp{50};
+    uint8_t current_temp{25};
+    uint8_t humidity{40};
+    uint32_t seconds{0};                // Remaining time
+    int8_t material{9};                 // Index into MATERIAL_NAME
+    uint8_t cursor{0x00};               // Cursor byte (0x00 = no cursor)
+    int8_t error{-1};                   // Error code shown instead of PV (-1 = none)
+
+    void encode(uint8_t *out) const {
+        using P = ActiveProtocol;
+        auto pair = [out](uint8_t offset, uint8_t value) {
+            out[offset] = P::DIGITS[value / 10 % 10];
+            out[offset + 1] = P::DIGITS[value % 10];
+        };
+        memset(out, 0, P::FRAME_SIZE);
+        out[0] = P::ADDRESS;
+        out[P::CURSOR_OFFSET] = cursor;
+        pair(P::SV_OFFSET, set_temp);
+        pair(P::PV_OFFSET, current_temp);
+        if (error >= 0) {
+            out[P::PV_OFFSET] = P::DIGITS[P::DIGIT_E];
+            out[P::PV_OFFSET + 1] = P::DIGITS[error];
+        }
+        out[P::UNITS_OFFSET] = P::UNITS[0].value;
+        out[P::MATERIAL_OFFSET] = P::MATERIAL_XOR[material];   // The other material bytes XOR to 0
+        pair(P::RH_OFFSET, humidity);
+        pair(P::HOURS_OFFSET, seconds / 3600);
+        pair(P::MINUTES_OFFSET, seconds / 60 % 60);
+        pair(P::SECONDS_OFFSET, seconds % 60);
+    }
+};
+
+/**
+ * The component with simulated bus input and its internals exposed
+ */
+class HostDryer : public I2CCrealityPiDryer {
+ public:
+  static constexpr uint32_t LOOP_INTERVAL_MS = 16;    // ESPHome main loop interval
+
+  using I2CCrealityPiDryer::device_state_;
+  using I2CCrealityPiDryer::filter_config_;
+  using I2CCrealityPiDryer::power_;
+  using I2CCrealityPiDryer::profile_;
+  using I2CCrealityPiDryer::snapshot_;
+  using I2CCrealityPiDryer::stats_;
+#ifdef USE_CREALITY_DRYER_SESSIONS
+  using I2CCrealityPiDryer::sessions_;
+#endif
+
+  HostDryer() {
+      capture_.status = static_cast<uint8_t>(I2CStatus::READY);
+      capture_.byte_num = 0;
+      capture_.last_edge = micros();
+  }
+
+  /**
+   * Bus silent until `ms`: loop() passes only
+   */
+  void run_until(uint32_t ms) {
+      while ((int32_t)(ms - host_millis) > 0) {
+          uint32_t step = ms - host_millis < LOOP_INTERVAL_MS ? ms - host_millis : LOOP_INTERVAL_MS;
+          host_millis += step;
+          if (loop_enabled) loop();
+      }
+  }
+
+  /**
+   * One frame ending at `ms` (bytes as captured, possibly truncated), then
+   * the loop() pass that processes it
+   */
+  void feed(uint32_t ms, const uint8_t *bytes, uint8_t length) {
+      run_until(ms);
+      for (uint8_t i = 0; i < length && i < CaptureState::BUFFER_SIZE; i++) capture_.buffer[i] = bytes[i];
+      capture_.byte_num = length;
+      capture_.last_edge = micros();
+      capture_.status = static_cast<uint8_t>(I2CStatus::STOP);
+      if (loop_enabled) loop();
+  }
+
+  void feed(uint32_t ms, const FrameFields &fields) {
+      uint8_t bytes[ActiveProtocol::FRAME_SIZE];
+      fields.encode(bytes);
+      feed(ms, bytes, sizeof(bytes));
+  }
+};
+
+}  // namespace i2c_creality_pi_dryer
+}  // namespace esphome
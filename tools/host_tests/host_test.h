@@ -0,0 +1,34 @@
+/**
+ * Minimal check macros for the host tests (run by tools/host_tests.py)
+ * A failed CHECK prints its location and expression; main() returns
+ * host_test_result(), non-zero if any check failed.
+ */
+#pragma once
+
+#include <cstdio>
+
+static int g_host_test_failures = 0;
+
+#define CHECK(expr)                                                                     \
+    do {                                                                                \
+        if (!(expr)) {                                                                  \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr);    \
+            g_host_test_failures++;                                                     \
+        }                                                                               \
+    } while (0)
+
+#define CHECK_EQ(actual, expected)                                                      \
+    do {                                                                                \
+        long long actual_ = (long long)(actual);                                        \
+        long long expected_ = (long long)(expected);                                    \
+        if (actual_ != expected_) {                                                     \
+            fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n",           \
+                    __FILE__, __LINE__, #actual, #expected, actual_, expected_);        \
+            g_host_test_failures++;                                                     \
+        }                                                                               \
+    } while (0)
+
+static inline int host_test_result() {
+    if (g_host_test_failures) fprintf(stderr, "%d check(s) failed\n", g_host_test_failures);
+    return g_host_test_failures ? 1 : 0;
+}
@@ -0,0 +1,36 @@
+#pragma once
+// Host build: GPIO driver calls succeed and do nothing (edges are simulated
+// by loading the capture state directly)
+#include <cstdint>
+
+typedef int esp_err_t;
+typedef int gpio_num_t;
+typedef void (*gpio_isr_t)(void *);
+
+enum gpio_int_type_t {
+    GPIO_INTR_DISABLE,
+    GPIO_INTR_POSEDGE,
+    GPIO_INTR_NEGEDGE,
+    GPIO_INTR_ANYEDGE,
+    GPIO_INTR_LOW_LEVEL,
+    GPIO_INTR_HIGH_LEVEL
+};
+enum gpio_mode_t { GPIO_MODE_INPUT = 1 };
+enum gpio_pulldown_t { GPIO_PULLDOWN_DISABLE, GPIO_PULLDOWN_ENABLE };
+enum gpio_pullup_t { GPIO_PULLUP_DISABLE, GPIO_PULLUP_ENABLE };
+
+struct gpio_config_t {
+    uint64_t pin_bit_mask;
+    gpio_mode_t mode;
+    gpio_pullup_t pull_up_en;
+    gpio_pulldown_t pull_down_en;
+    gpio_int_type_t intr_type;
+};
+
+inline esp_err_t gpio_config(const gpio_config_t *) { return 0; }
+inline esp_err_t gpio_install_isr_service(int) { return 0; }
+inline esp_err_t gpio_set_intr_type(gpio_num_t, gpio_int_type_t) { return 0; }
+inline esp_err_t gpio_isr_handler_add(gpio_num_t, gpio_isr_t, void *) { return 0; }
+inline esp_err_t gpio_intr_enable(gpio_num_t) { return 0; }
+inline esp_err_t gpio_intr_disable(gpio_num_t) { return 0; }
+inline int gpio_get_level(gpio_num_t) { return 1; }
@@ -0,0 +1,74 @@
+#pragma once
+// Host stand-in for the ESP-IDF partition API: one in-memory data partition
+// with NOR flash semantics (erase sets sectors to 0xFF, writes only clear bits)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+enum esp_partition_type_t { ESP_PARTITION_TYPE_DATA = 0x01 };
+enum esp_partition_subtype_t { ESP_PARTITION_SUBTYPE_ANY = 0xFF };
+
+struct esp_partition_t {
+    uint32_t size;
+    const char *label;
+};
+
+struct HostFlash {
+    static constexpr size_t SECTOR_SIZE = 4096;
+
+    esp_partition_t partition{0, "dryer_rec"};
+    std::vector<uint8_t> data;
+    uint32_t erases{0};
+};
+
+inline HostFlash &host_flash() {
+    static HostFlash flash;
+    return flash;
+}
+
+/**
+ * Fresh (erased) partition of `sectors` sectors; 0 = no partition
+ */
+inline void host_flash_reset(uint32_t sectors) {
+    HostFlash &flash = host_flash();
+    flash.partition.size = sectors * HostFlash::SECTOR_SIZE;
+    flash.data.assign(flash.partition.size, 0xFF);
+    flash.erases = 0;
+}
+
+inline const esp_partition_t *esp_partition_find_first(esp_partition_type_t, esp_partition_subtype_t,
+                                                        const char *label) {
+    HostFlash &flash = host_flash();
+    if (flash.partition.size == 0 || strcmp(label, flash.partition.label) != 0) return nullptr;
+    return &flash.partition;
+}
+
+inline esp_err_t esp_partition_read(const esp_partition_t *, size_t offset, void *dst, size_t size) {
+    HostFlash &flash = host_flash();
+    if (offset + size > flash.data.size()) return ESP_FAIL;
+    memcpy(dst, flash.data.data() + offset, size);
+    return ESP_OK;
+}
+
+inline esp_err_t esp_partition_write(const esp_partition_t *, size_t offset, const void *src, size_t size) {
+    HostFlash &flash = host_flash();
+    if (offset + size > flash.data.size()) return ESP_FAIL;
+    const uint8_t *bytes = static_cast<const uint8_t *>(src);
+    for (size_t i = 0; i < size; i++) flash.data[offset + i] &= bytes[i];
+    return ESP_OK;
+}
+
+inline esp_err_t esp_partition_erase_range(const esp_partition_t *, size_t offset, size_t size) {
+    HostFlash &flash = host_flash();
+    if (offset % HostFlash::SECTOR_SIZE || size % HostFlash::SECTOR_SIZE || offset + size > flash.data.size()) {
+        return ESP_FAIL;
+    }
+    memset(flash.data.data() + offset, 0xFF, size);
+    flash.erases++;
+    return ESP_OK;
+}
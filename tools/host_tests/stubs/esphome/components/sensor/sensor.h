@@ -0,0 +1,21 @@
+#pragma once
+// Host build: sensors keep their last state and count publishes
+#include <cmath>
+#include <cstdint>
+
+namespace esphome {
+namespace sensor {
+
+class Sensor {
+ public:
+  void publish_state(float value) {
+    state = value;
+    publishes++;
+  }
+
+  float state{NAN};
+  uint32_t publishes{0};
+};
+
+}  // namespace sensor
+}  // namespace esphome
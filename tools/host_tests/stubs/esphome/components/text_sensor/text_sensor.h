@@ -0,0 +1,21 @@
+#pragma once
+// Host build: text sensors keep their last state and count publishes
+#include <cstdint>
+#include <string>
+
+namespace esphome {
+namespace text_sensor {
+
+class TextSensor {
+ public:
+  void publish_state(const std::string &value) {
+    state = value;
+    publishes++;
+  }
+
+  std::string state;
+  uint32_t publishes{0};
+};
+
+}  // namespace text_sensor
+}  // namespace esphome
@@ -0,0 +1,27 @@
+#pragma once
+// Host build: lifecycle is driven by the test (setup() once, loop() per pass)
+#include <cstdint>
+
+namespace esphome {
+
+namespace setup_priority {
+static constexpr float LATE = -100.0f;
+}  // namespace setup_priority
+
+class Component {
+ public:
+  virtual ~Component() = default;
+  virtual void setup() {}
+  virtual void loop() {}
+  virtual void dump_config() {}
+  virtual float get_setup_priority() const { return 0.0f; }
+
+  // Loop scheduling is recorded, the test decides whether to keep calling loop()
+  void disable_loop() { loop_enabled = false; }
+  void enable_loop() { loop_enabled = true; }
+  void enable_loop_soon_any_context() { loop_enabled = true; }
+
+  bool loop_enabled{true};
+};
+
+}  // namespace esphome
@@ -0,0 +1,3 @@
+#pragma once
+// Host build of the component headers: model selection only
+#define USE_CREALITY_DRYER_MODEL_SPACE_PI_PLUS
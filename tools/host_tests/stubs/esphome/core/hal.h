@@ -0,0 +1,27 @@
+#pragma once
+// Host build: ISR code runs as plain functions, time is simulated
+#include <chrono>
+#include <cstdint>
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+namespace esphome {
+
+// Simulated millis(), advanced by the test; micros() follows it
+inline uint32_t host_millis = 0;
+
+inline uint32_t millis() { return host_millis; }
+inline uint32_t micros() { return host_millis * 1000; }
+inline void delay(uint32_t ms) { host_millis += ms; }
+inline void yield() {}
+
+// The cycle counter runs on host time at one cycle per nanosecond, so the
+// component's stage timings read as host nanoseconds
+inline uint32_t arch_get_cpu_freq_hz() { return 1000000000u; }
+inline uint32_t arch_get_cpu_cycle_count() {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return (uint32_t) std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+}  // namespace esphome
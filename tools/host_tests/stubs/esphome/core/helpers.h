@@ -0,0 +1,36 @@
+#pragma once
+// Host build: the ESPHome helpers the component uses
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace esphome {
+
+class Mutex {
+ public:
+  void lock() { mutex_.lock(); }
+  void unlock() { mutex_.unlock(); }
+
+ protected:
+  std::mutex mutex_;
+};
+
+class LockGuard {
+ public:
+  explicit LockGuard(Mutex &mutex) : mutex_(mutex) { mutex_.lock(); }
+  ~LockGuard() { mutex_.unlock(); }
+
+ protected:
+  Mutex &mutex_;
+};
+
+inline uint32_t fnv1_hash(const std::string &str) {
+    uint32_t hash = 2166136261UL;
+    for (char c : str) {
+        hash *= 16777619UL;
+        hash ^= c;
+    }
+    return hash;
+}
+
+}  // namespace esphome
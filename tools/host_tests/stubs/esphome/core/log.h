@@ -0,0 +1,11 @@
+#pragma once
+// Host build: component logging is dropped (arguments are still evaluated,
+// so nothing is left unused)
+template<typename... Args> inline void host_log_discard(const char *, const Args &...) {}
+
+#define ESP_LOGE(tag, ...) host_log_discard(tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) host_log_discard(tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) host_log_discard(tag, __VA_ARGS__)
+#define ESP_LOGD(tag, ...) host_log_discard(tag, __VA_ARGS__)
+#define ESP_LOGV(tag, ...) host_log_discard(tag, __VA_ARGS__)
+#define ESP_LOGCONFIG(tag, ...) host_log_discard(tag, __VA_ARGS__)
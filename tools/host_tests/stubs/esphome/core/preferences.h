@@ -0,0 +1,45 @@
+#pragma once
+// Host build: preferences kept in memory (they survive a component restart
+// within the test process)
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <vector>
+
+namespace esphome {
+
+class ESPPreferenceObject {
+ public:
+  ESPPreferenceObject() = default;
+  explicit ESPPreferenceObject(std::vector<uint8_t> *data) : data_(data) {}
+
+  template<typename T> bool save(const T *src) {
+    if (data_ == nullptr) return false;
+    data_->assign(reinterpret_cast<const uint8_t *>(src), reinterpret_cast<const uint8_t *>(src) + sizeof(T));
+    return true;
+  }
+  template<typename T> bool load(T *dest) {
+    if (data_ == nullptr || data_->size() != sizeof(T)) return false;
+    memcpy(dest, data_->data(), sizeof(T));
+    return true;
+  }
+
+ protected:
+  std::vector<uint8_t> *data_{nullptr};
+};
+
+class ESPPreferences {
+ public:
+  template<typename T> ESPPreferenceObject make_preference(uint32_t type, bool in_flash) {
+    (void) in_flash;
+    return ESPPreferenceObject(&store[type]);
+  }
+  bool sync() { return true; }
+
+  std::map<uint32_t, std::vector<uint8_t>> store;
+};
+
+inline ESPPreferences host_preferences;
+inline ESPPreferences *global_preferences = &host_preferences;
+
+}  // namespace esphome
@@ -0,0 +1,3 @@
+#pragma once
+// Host stand-in for lwIP address helpers (inet_addr, htons)
+#include <arpa/inet.h>
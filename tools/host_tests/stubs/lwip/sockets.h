@@ -0,0 +1,30 @@
+#pragma once
+// Host stand-in for the lwIP socket API: datagrams passed to lwip_sendto()
+// are captured in memory instead of being sent
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+struct HostUdp {
+    std::vector<std::vector<uint8_t>> datagrams;    // Every datagram sent, in order
+    sockaddr_in last_dest{};                        // Destination of the last datagram
+    bool fail{false};                               // Make sendto() fail (WiFi down)
+};
+
+inline HostUdp &host_udp() {
+    static HostUdp udp;
+    return udp;
+}
+
+inline int lwip_socket(int, int, int) { return 3; }
+
+inline int lwip_sendto(int, const void *data, size_t size, int, const struct sockaddr *to, socklen_t) {
+    HostUdp &udp = host_udp();
+    if (udp.fail) return -1;
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    udp.datagrams.emplace_back(bytes, bytes + size);
+    udp.last_dest = *reinterpret_cast<const sockaddr_in *>(to);
+    return (int) size;
+}
@@ -0,0 +1,253 @@
+/**
+ * Host test: bus capture state machine (dryer_capture.h) and the fast-path
+ * transaction logger timing (CycleClock + BusLogger)
+ * SimBus drives capture_clock()/capture_data() edge by edge the way
+ * handle_scl_interrupt_fast() and handle_sda_interrupt_fast() do: every edge
+ * is stamped with a simulated CPU cycle counter, the logger gets its times
+ * through the CycleClock that loop() keeps anchored.
+ */
+
+#include "dryer_capture.h"
+#include "dryer_bus_logger.h"
+#include "host_test.h"
+
+using namespace esphome::i2c_creality_pi_dryer;
+
+static constexpr uint32_t CPU_MHZ = 240;         // Cycles per microsecond
+static constexpr uint32_t HALF_PERIOD_US = 5;    // 100 kHz bus
+
+/**
+ * Exposes the logger's ring (BusLogger::read() lives in the component's .cpp)
+ */
+struct TestLogger : BusLogger {
+    uint32_t count() const { return head_; }
+    const BusTransaction &at(uint32_t index) const { return ring_[index % RING_SIZE]; }
+};
+
+/**
+ * Simulated bus with the fast ISRs attached
+ */
+struct SimBus {
+    CaptureState cap;
+    TestLogger logger;
+    CycleClock clock;
+    uint32_t now_us{1000};               // micros()
+    uint32_t cycles{0xFFFF0000u};        // Cycle counter (wraps during the tests)
+    int scl{1};
+    int sda{1};
+
+    SimBus() {
+        clock.cycles_per_us = CPU_MHZ;
+        anchor();
+    }
+
+    /** loop() pass: re-anchor the conversion */
+    void anchor() { clock.set_anchor(cycles, now_us); }
+
+    void wait() {
+        now_us += HALF_PERIOD_US;
+        cycles += HALF_PERIOD_US * CPU_MHZ;
+    }
+
+    /** handle_scl_interrupt_fast() on a rising edge */
+    void set_scl(int level) {
+        wait();
+        scl = level;
+        if (!level) return;
+        if (logger.is_capturing()) logger.on_clock(sda);
+        capture_clock(cap, [this] { return sda; });
+        cap.last_edge = cycles;
+    }
+
+    /** handle_sda_interrupt_fast() */
+    CaptureEvent set_sda(int level) {
+        if (level == sda) return CaptureEvent::NONE;
+        wait();
+        sda = level;
+        uint32_t prev_edge = cap.last_edge;
+        CaptureEvent event = capture_data(cap, scl, sda);
+        if (event == CaptureEvent::START) {
+            logger.on_start(clock.to_us(cycles), clock.to_us(prev_edge));
+        } else if (event == CaptureEvent::STOP) {
+            logger.on_stop(clock.to_us(cycles));
+        }
+        cap.last_edge = cycles;
+        return event;
+    }
+
+    /** START from idle, or repeated START after an acknowledge */
+    void start() {
+        if (!scl) {
+            set_sda(1);
+            set_scl(1);
+        }
+        CHECK(set_sda(0) == CaptureEvent::START);
+        set_scl(0);
+    }
+
+    void stop() {
+        set_sda(0);
+        set_scl(1);
+        CHECK(set_sda(1) == CaptureEvent::STOP);
+    }
+
+    /** Eight data clocks (MSB first), then the acknowledge clock */
+    void byte(uint8_t value, bool ack = true) {
+        for (int bit = 7; bit >= 0; bit--) {
+            CHECK(set_sda((value >> bit) & 1) == CaptureEvent::NONE);   // Data changes while SCL low
+            set_scl(1);
+            set_scl(0);
+        }
+        set_sda(ack ? 0 : 1);
+        set_scl(1);
+        set_scl(0);
+    }
+};
+
+static void check_buffer(const SimBus &bus, const uint8_t *expected, uint8_t length) {
+    CHECK_EQ(bus.cap.byte_num, length);
+    for (uint8_t i = 0; i < length && i < bus.cap.byte_num; i++) CHECK_EQ(bus.cap.buffer[i], expected[i]);
+}
+
+/**
+ * START, address, data with ACK (and a NACKed last byte), STOP
+ */
+static void test_write_frame() {
+    SimBus bus;
+    const uint8_t frame[] = {0x7E << 1, 0x01, 0x80, 0xA5, 0xFF};
+
+    bus.start();
+    CHECK(bus.cap.status == static_cast<uint8_t>(I2CStatus::RECEIVING));
+    for (size_t i = 0; i < sizeof(frame); i++) bus.byte(frame[i], i + 1 < sizeof(frame));
+    CHECK_EQ(bus.cap.bit_num, 0);
+    CHECK(!bus.cap.wait_ack);
+    bus.stop();
+
+    CHECK(bus.cap.status == static_cast<uint8_t>(I2CStatus::STOP));
+    check_buffer(bus, frame, sizeof(frame));
+
+    CHECK_EQ(bus.logger.count(), 1);
+    const BusTransaction &t = bus.logger.at(0);
+    CHECK_EQ(t.address, 0x7E);
+    CHECK_EQ(t.flags, 0);
+    CHECK_EQ(t.length, sizeof(frame) - 1);
+    CHECK_EQ(t.data[2], 0xA5);
+    CHECK_EQ(t.nack_mask, 1u << (sizeof(frame) - 1));
+    CHECK_EQ(t.start_us, 1000 + HALF_PERIOD_US);     // SDA fell one half period after the bus was idle
+    CHECK_EQ(t.duration_us, bus.now_us - t.start_us);
+}
+
+/**
+ * STOP without a frame in progress and SDA edges while SCL is low change nothing
+ */
+static void test_idle_edges() {
+    SimBus bus;
+    bus.set_scl(0);
+    CHECK(bus.set_sda(0) == CaptureEvent::NONE);
+    CHECK(bus.set_sda(1) == CaptureEvent::NONE);
+    bus.set_scl(1);
+    CHECK(bus.cap.status == static_cast<uint8_t>(I2CStatus::READY));
+    CHECK_EQ(bus.cap.byte_num, 0);
+
+    // Clocks without a START are not captured
+    bus.set_scl(0);
+    bus.byte(0x55);
+    CHECK_EQ(bus.cap.byte_num, 0);
+    CHECK(bus.cap.status == static_cast<uint8_t>(I2CStatus::READY));
+
+    bus.start();
+    bus.stop();
+    CHECK(bus.cap.status == static_cast<uint8_t>(I2CStatus::STOP));
+    CHECK_EQ(bus.cap.byte_num, 0);
+    CHECK_EQ(bus.logger.count(), 0);    // START + STOP without an address is not logged
+}
+
+/**
+ * Repeated START restarts the frame; the logger ends the first transaction at
+ * the last edge before the repeated START, not at the START itself
+ */
+static void test_repeated_start() {
+    SimBus bus;
+    const uint8_t read[] = {(0x50 << 1) | 1, 0x42};
+
+    bus.start();
+    uint32_t first_start_us = bus.now_us - HALF_PERIOD_US;
+    bus.byte(0x50 << 1);
+    bus.byte(0x10);
+    bus.anchor();                       // A loop() pass in between
+
+    // Repeated START: SDA released and SCL raised (the last edge of the first
+    // transaction), then SDA falls
+    bus.set_sda(1);
+    bus.set_scl(1);
+    uint32_t last_edge_us = bus.now_us;
+    CHECK(bus.set_sda(0) == CaptureEvent::START);
+    uint32_t second_start_us = bus.now_us;
+    bus.set_scl(0);
+    for (uint8_t value : read) bus.byte(value, value != read[sizeof(read) - 1]);
+    bus.stop();
+    uint32_t stop_us = bus.now_us;
+
+    // Capture keeps only the frame after the repeated START
+    CHECK(bus.cap.status == static_cast<uint8_t>(I2CStatus::STOP));
+    check_buffer(bus, read, sizeof(read));
+
+    CHECK_EQ(bus.logger.count(), 2);
+    const BusTransaction &first = bus.logger.at(0);
+    CHECK_EQ(first.address, 0x50);
+    CHECK_EQ(first.flags, BusTransaction::FLAG_NO_STOP);
+    CHECK_EQ(first.length, 1);
+    CHECK_EQ(first.data[0], 0x10);
+    CHECK_EQ(first.start_us, first_start_us);
+    CHECK_EQ(first.duration_us, last_edge_us - first_start_us);
+
+    const BusTransaction &second = bus.logger.at(1);
+    CHECK_EQ(second.address, 0x50);
+    CHECK_EQ(second.flags, BusTransaction::FLAG_REPEATED_START | BusTransaction::FLAG_READ);
+    CHECK_EQ(second.data[0], 0x42);
+    CHECK_EQ(second.start_us, second_start_us);
+    CHECK_EQ(second.duration_us, stop_us - second_start_us);
+}
+
+/**
+ * A frame without STOP is handed over by the timeout if it holds data
+ */
+static void test_timeout() {
+    SimBus bus;
+    bus.start();
+    capture_timeout(bus.cap);
+    CHECK(bus.cap.status == static_cast<uint8_t>(I2CStatus::READY));
+
+    bus.start();
+    bus.byte(0x7E << 1);
+    bus.byte(0x33);
+    capture_timeout(bus.cap);
+    CHECK(bus.cap.status == static_cast<uint8_t>(I2CStatus::STOP));
+    CHECK_EQ(bus.cap.byte_num, 2);
+}
+
+/**
+ * Conversion across the cycle counter wrap and on both sides of the anchor
+ */
+static void test_cycle_clock() {
+    CycleClock clock;
+    clock.cycles_per_us = CPU_MHZ;
+    clock.set_anchor(0xFFFFFF00u, 5000);
+    CHECK_EQ(clock.to_us(0xFFFFFF00u), 5000);
+    CHECK_EQ(clock.to_us(0xFFFFFF00u + 10 * CPU_MHZ), 5010);      // Past the wrap
+    CHECK_EQ(clock.to_us(0xFFFFFF00u - 10 * CPU_MHZ), 4990);      // Before the anchor
+
+    // New anchor after the wrap (micros() wrapping as well)
+    clock.set_anchor(1000 * CPU_MHZ, 0xFFFFFFF0u);
+    CHECK_EQ(clock.to_us(1000 * CPU_MHZ + 32 * CPU_MHZ), 0x10);
+    CHECK_EQ(clock.to_us(990 * CPU_MHZ), 0xFFFFFFF0u - 10);
+}
+
+int main() {
+    test_write_frame();
+    test_idle_edges();
+    test_repeated_start();
+    test_timeout();
+    test_cycle_clock();
+    return host_test_result();
+}
@@ -0,0 +1,140 @@
+/**
+ * Host test: low-power idle state machine (dryer_idle.h)
+ * Drives IdleController with a simulated millis() clock the way the
+ * component does: on_power_off()/on_power_on() from frame processing,
+ * on_edge() from the SCL ISR and poll() from loop().
+ */
+
+#include "dryer_idle.h"
+#include "host_test.h"
+
+using namespace esphome::i2c_creality_pi_dryer;
+using Action = IdleController::Action;
+using State = IdleController::State;
+
+/**
+ * Simulated millis()
+ */
+struct SimClock {
+    uint32_t now_ms{0};
+    uint32_t advance(uint32_t ms) { return now_ms += ms; }
+};
+
+/**
+ * Off for exactly the enter delay before idling; frames in between cancel it
+ */
+static void test_enter_delay() {
+    SimClock clock;
+    IdleController idle;
+    idle.set_enter_delay_ms(5000);
+
+    idle.on_power_off(clock.now_ms);
+    CHECK(idle.get_state() == State::PENDING);
+    CHECK(idle.poll(clock.advance(4999)) == Action::NONE);
+    CHECK(!idle.is_suspended());
+
+    // Dryer back on before the delay: stays awake
+    idle.on_power_on();
+    CHECK(idle.get_state() == State::ACTIVE);
+    CHECK(idle.poll(clock.advance(10000)) == Action::NONE);
+
+    // Off again: the delay restarts from the new power-off
+    idle.on_power_off(clock.now_ms);
+    CHECK(idle.poll(clock.advance(4999)) == Action::NONE);
+    CHECK(idle.poll(clock.advance(1)) == Action::ENTER_IDLE);
+    CHECK(idle.is_idle());
+    CHECK(idle.is_suspended());
+    CHECK_EQ(idle.get_entries(), 1);
+
+    // Already idle: nothing more to do, power-off reports are ignored
+    CHECK(idle.poll(clock.advance(60000)) == Action::NONE);
+    idle.on_power_off(clock.now_ms);
+    CHECK(idle.is_idle());
+}
+
+/**
+ * First edge wakes, further edges until the loop runs do nothing
+ */
+static void test_wake_on_edge() {
+    SimClock clock;
+    IdleController idle;
+    idle.set_enter_delay_ms(2000);
+
+    // Edges while awake are not wakes
+    CHECK(!idle.on_edge(clock.now_ms));
+    idle.on_power_off(clock.now_ms);
+    CHECK(!idle.on_edge(clock.advance(100)));
+    CHECK(idle.poll(clock.advance(1900)) == Action::ENTER_IDLE);
+
+    uint32_t edge_ms = clock.advance(30000);
+    CHECK(idle.on_edge(edge_ms));
+    CHECK(idle.get_state() == State::WAKING);
+    CHECK(idle.is_suspended());     // No capture until the loop resumes
+    CHECK(!idle.on_edge(clock.advance(1)));
+    CHECK(!idle.on_edge(clock.advance(1)));
+
+    // Loop runs 14 ms after the waking edge
+    CHECK(idle.poll(edge_ms + 14) == Action::RESUME);
+    clock.now_ms = edge_ms + 14;
+    CHECK(!idle.is_suspended());
+    CHECK_EQ(idle.get_last_wake_latency_ms(), 14);
+    CHECK_EQ(idle.get_max_wake_latency_ms(), 14);
+    CHECK(idle.poll(clock.advance(1)) == Action::NONE);
+}
+
+/**
+ * After a wake without frames the controller idles again; with frames it stays awake
+ */
+static void test_reentry() {
+    SimClock clock;
+    IdleController idle;
+    idle.set_enter_delay_ms(5000);
+
+    idle.on_power_off(clock.now_ms);
+    CHECK(idle.poll(clock.advance(5000)) == Action::ENTER_IDLE);
+
+    // Spurious edge (no frames follow): idle again one delay after the resume
+    CHECK(idle.on_edge(clock.advance(1000)));
+    CHECK(idle.poll(clock.advance(3)) == Action::RESUME);
+    CHECK(idle.get_state() == State::PENDING);
+    CHECK(idle.poll(clock.advance(4999)) == Action::NONE);
+    CHECK(idle.poll(clock.advance(1)) == Action::ENTER_IDLE);
+    CHECK_EQ(idle.get_entries(), 2);
+
+    // Real wake: the dryer powers on, so it stays awake
+    CHECK(idle.on_edge(clock.advance(1000)));
+    CHECK(idle.poll(clock.advance(20)) == Action::RESUME);
+    idle.on_power_on();
+    CHECK(idle.get_state() == State::ACTIVE);
+    CHECK(idle.poll(clock.advance(60000)) == Action::NONE);
+    CHECK_EQ(idle.get_entries(), 2);
+    CHECK_EQ(idle.get_max_wake_latency_ms(), 20);
+}
+
+/**
+ * Delay and latency survive the millis() wrap
+ */
+static void test_clock_wrap() {
+    SimClock clock;
+    clock.now_ms = 0xFFFFF000u;
+    IdleController idle;
+
+    idle.on_power_off(clock.now_ms);
+    CHECK(idle.poll(clock.advance(IdleController::DEFAULT_ENTER_DELAY_MS - 1)) == Action::NONE);
+    CHECK(idle.poll(clock.advance(1)) == Action::ENTER_IDLE);
+    CHECK(clock.now_ms < 0xFFFFF000u);   // Wrapped
+
+    // Edge just before the next wrap, loop just after it
+    clock.now_ms = 0xFFFFFF00u;
+    CHECK(idle.on_edge(clock.now_ms));
+    CHECK(idle.poll(clock.advance(0x110)) == Action::RESUME);
+    CHECK_EQ(idle.get_last_wake_latency_ms(), 0x110);
+}
+
+int main() {
+    test_enter_delay();
+    test_wake_on_edge();
+    test_reentry();
+    test_clock_wrap();
+    return host_test_result();
+}
@@ -0,0 +1,108 @@
+/**
+ * Host test: power-off detection shared by the component and the replay
+ * A gap of a few frame periods is a power cycle for both the component
+ * (bus silence in handle_timeouts()) and tools/dryer_replay.h (gap between
+ * recorded frames), so filter_replay.py tunes on the same power cycles the
+ * device sees; a shorter gap is not.
+ */
+
+#define USE_CREALITY_DRYER_HUMIDITY
+#include "host_dryer.h"
+#include "dryer_replay.h"
+#include "host_test.h"
+
+using namespace esphome;
+using namespace esphome::i2c_creality_pi_dryer;
+
+static constexpr uint32_t PERIOD_MS = 100;      // Display frame period
+
+/**
+ * Counts humidity publishes of the replay
+ */
+struct CountingSink {
+    uint32_t humidity{0};
+
+    void publish(uint32_t, const char *channel, unsigned) { humidity += strcmp(channel, "humidity") == 0; }
+    void publish(uint32_t, const char *, const char *) {}
+};
+
+/**
+ * Humidity publishes of the component and of the replay for 50 frames, a
+ * gap of `gap_ms` and 50 more frames, all with the same value
+ */
+static void run(uint32_t gap_ms, uint32_t &component, uint32_t &replayed, bool &off_in_gap) {
+    host_millis = 1000;
+    HostDryer dryer;
+    sensor::Sensor humidity;
+    dryer.set_humidity_sensor(&humidity);
+    dryer.setup();
+    Replay<CountingSink> replay;
+
+    FrameFields fields;
+    Frame frame{};
+    fields.encode(frame.bytes);
+    uint32_t ms = host_millis;
+    off_in_gap = false;
+    for (int i = 0; i < 100; i++) {
+        ms += i == 50 ? gap_ms : PERIOD_MS;
+        if (i == 50) {
+            CHECK_EQ(dryer.power_.frame_period_ms, PERIOD_MS);
+            CHECK_EQ(replay.power.frame_period_ms, PERIOD_MS);
+            dryer.run_until(ms - 1);
+            off_in_gap = dryer.device_state_ == DeviceState::OFF;
+        }
+        dryer.feed(ms, fields);
+        frame.ms = ms;
+        replay.feed(frame);
+    }
+    component = humidity.publishes;
+    replayed = replay.sink.humidity;
+}
+
+/**
+ * One second of silence at a 100 ms period: off, filters start over
+ */
+static void test_short_power_cycle() {
+    uint32_t component, replayed;
+    bool off;
+    run(1000, component, replayed, off);
+    CHECK(off);
+    CHECK_EQ(component, 3);                     // Value, NAN at power-off, value again
+    CHECK_EQ(replayed, 2);
+}
+
+/**
+ * A gap below SILENCE_FRAMES periods: still on, nothing published again
+ */
+static void test_short_gap() {
+    uint32_t component, replayed;
+    bool off;
+    run(PERIOD_MS * (PowerDetector::SILENCE_FRAMES - 1), component, replayed, off);
+    CHECK(!off);
+    CHECK_EQ(component, 1);
+    CHECK_EQ(replayed, 1);
+}
+
+/**
+ * Timeout bounds: MIN_SILENCE_MS for fast buses, DEVICE_TIMEOUT_MS at most
+ */
+static void test_timeout_bounds() {
+    PowerDetector power;
+    bool bus_silent;
+    CHECK(!power.is_off(5000, 100, bus_silent));     // Period unknown: only the fallback applies
+    CHECK(power.is_off(0, PowerDetector::DEVICE_TIMEOUT_MS + 1, bus_silent) && !bus_silent);
+    power.on_frame(10);
+    CHECK_EQ(power.silence_timeout_ms(), PowerDetector::MIN_SILENCE_MS);
+    power.on_frame(2000);
+    CHECK_EQ(power.silence_timeout_ms(), PowerDetector::DEVICE_TIMEOUT_MS);
+    // Peak-hold: a shorter interval only decays the period by 1/16
+    power.on_frame(100);
+    CHECK_EQ(power.frame_period_ms, 2000 - 2000 / 16);
+}
+
+int main() {
+    test_short_power_cycle();
+    test_short_gap();
+    test_timeout_bounds();
+    return host_test_result();
+}
@@ -0,0 +1,131 @@
+/**
+ * Host test: drying session records on a minimal configuration
+ * Only `sessions:` is configured (no set temperature, humidity or material
+ * sensor), yet every stored record must carry those values: session
+ * tracking decodes the channels it records on its own.
+ */
+
+#define USE_CREALITY_DRYER_SESSIONS
+#include "host_dryer.h"
+#include "host_test.h"
+
+using namespace esphome;
+using namespace esphome::i2c_creality_pi_dryer;
+
+static constexpr uint32_t PERIOD_MS = 100;      // Display frame period
+
+/**
+ * Idle, a complete countdown (humidity falling on the way), idle again
+ */
+static void test_completed_session() {
+    host_millis = 1000;
+    HostDryer dryer;
+    dryer.setup();
+
+    uint32_t ms = host_millis;
+    FrameFields frame;
+    frame.set_temp = 55;
+    frame.humidity = 41;
+    frame.material = 9;                         // PLA
+    for (int i = 0; i < 50; i++) dryer.feed(ms += PERIOD_MS, frame);
+    CHECK(dryer.device_state_ == DeviceState::IDLE);
+
+    // Time set to 150 s with the cursor on Time, then the countdown runs
+    // (one tick per second)
+    frame.cursor = 0x02;
+    for (uint32_t left = 150; left > 0; left--) {
+        if (left == 145) frame.cursor = 0x00;
+        frame.seconds = left;
+        frame.humidity = left > 75 ? 41 : 33;
+        for (int i = 0; i < 10; i++) dryer.feed(ms += PERIOD_MS, frame);
+    }
+    CHECK(dryer.device_state_ == DeviceState::DRYING);
+
+    frame.seconds = 0;
+    for (int i = 0; i < 50; i++) dryer.feed(ms += PERIOD_MS, frame);
+    CHECK(dryer.device_state_ == DeviceState::IDLE);
+
+    SessionRecord rec{};
+    CHECK(dryer.sessions_.get_last(rec));
+    CHECK_EQ(rec.number, 1);
+    CHECK_EQ(rec.outcome, static_cast<uint8_t>(SessionOutcome::COMPLETED));
+    CHECK_EQ(rec.set_temp, 55);
+    CHECK_EQ(rec.material, 9);
+    CHECK_EQ(rec.initial_rh, 41);
+    CHECK_EQ(rec.final_rh, 33);
+    CHECK(rec.duration_s >= 148 && rec.duration_s <= 152);
+
+    char json[256];
+    SessionTracker::format(rec, json, sizeof(json));
+    CHECK(strstr(json, "null") == nullptr);
+}
+
+/**
+ * Power lost mid-run: the record is stored with the values seen so far
+ */
+static void test_power_off_session() {
+    host_millis = 1000;
+    host_preferences.store.clear();
+    HostDryer dryer;
+    dryer.setup();
+
+    uint32_t ms = host_millis;
+    FrameFields frame;
+    frame.set_temp = 70;
+    frame.humidity = 25;
+    frame.material = 2;                         // PETG
+    frame.seconds = 3600;
+    for (int i = 0; i < 300; i++) {
+        frame.seconds = 3600 - i / 10;
+        dryer.feed(ms += PERIOD_MS, frame);
+    }
+    CHECK(dryer.device_state_ == DeviceState::DRYING);
+
+    // Bus silent: off after a few frame periods
+    dryer.run_until(ms + 1000);
+    CHECK(dryer.device_state_ == DeviceState::OFF);
+
+    SessionRecord rec{};
+    CHECK(dryer.sessions_.get_last(rec));
+    CHECK_EQ(rec.outcome, static_cast<uint8_t>(SessionOutcome::POWER_OFF));
+    CHECK_EQ(rec.set_temp, 70);
+    CHECK_EQ(rec.material, 2);
+    CHECK_EQ(rec.initial_rh, 25);
+    CHECK_EQ(rec.final_rh, 25);
+}
+
+/**
+ * Run cancelled with the plausibility models on: time back to 0 without the
+ * cursor on it ends the session within the normal repeats
+ */
+static void test_cancelled_session() {
+    host_millis = 1000;
+    host_preferences.store.clear();
+    HostDryer dryer;
+    dryer.filter_config_.plausibility = 1;
+    dryer.setup();
+
+    uint32_t ms = host_millis;
+    FrameFields frame;
+    frame.seconds = 3600;
+    for (int i = 0; i < 300; i++) {
+        frame.seconds = 3600 - i / 10;
+        dryer.feed(ms += PERIOD_MS, frame);
+    }
+    CHECK(dryer.device_state_ == DeviceState::DRYING);
+
+    frame.seconds = 0;
+    for (uint32_t i = 0; i < dryer.filter_config_.drying_time_repeats; i++) dryer.feed(ms += PERIOD_MS, frame);
+    CHECK(dryer.device_state_ == DeviceState::IDLE);
+
+    SessionRecord rec{};
+    CHECK(dryer.sessions_.get_last(rec));
+    CHECK_EQ(rec.outcome, static_cast<uint8_t>(SessionOutcome::ABORTED));
+}
+
+int main() {
+    test_completed_session();
+    test_power_off_session();
+    test_cancelled_session();
+    return host_test_result();
+}
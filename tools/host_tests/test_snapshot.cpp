@@ -0,0 +1,82 @@
+/**
+ * Host test: aggregated snapshot sequence numbers
+ * Every published change set gets its own "seq", also when two come from
+ * the same frame (a value confirmed by the last frame, then power-off) and
+ * across power cycles.
+ */
+
+#define USE_CREALITY_DRYER_HUMIDITY
+#define USE_CREALITY_DRYER_DRYER_STATUS
+#include "host_dryer.h"
+#include "host_test.h"
+#include <cstdlib>
+
+using namespace esphome;
+using namespace esphome::i2c_creality_pi_dryer;
+
+static constexpr uint32_t PERIOD_MS = 100;      // Display frame period
+
+/**
+ * Snapshot "seq" of the last publish (-1 if none)
+ */
+static long seq_of(const text_sensor::TextSensor &snapshot) {
+    const char *seq = strstr(snapshot.state.c_str(), "\"seq\":");
+    return seq ? strtol(seq + 6, nullptr, 10) : -1;
+}
+
+/**
+ * Records every new snapshot's seq
+ */
+struct SeqLog {
+    const text_sensor::TextSensor &snapshot;
+    uint32_t seen{0};
+    long last{-1};
+    uint32_t published{0};
+
+    void check() {
+        if (snapshot.publishes == seen) return;
+        seen = snapshot.publishes;
+        long seq = seq_of(snapshot);
+        CHECK(seq > last);
+        last = seq;
+        published++;
+    }
+};
+
+static void test_unique_sequence() {
+    host_millis = 1000;
+    HostDryer dryer;
+    sensor::Sensor humidity;
+    text_sensor::TextSensor status, snapshot;
+    dryer.set_humidity_sensor(&humidity);
+    dryer.set_dryer_status_sensor(&status);
+    dryer.set_snapshot_sensor(&snapshot);
+    dryer.setup();
+    SeqLog log{snapshot};
+
+    uint32_t ms = host_millis;
+    FrameFields frame;
+    for (int cycle = 0; cycle < 2; cycle++) {
+        for (int i = 0; i < 30; i++) {
+            // Humidity change confirmed by the last frame before power-off
+            frame.humidity = i < 30 - dryer.filter_config_.humidity_repeats ? 40 : 35;
+            dryer.feed(ms += PERIOD_MS, frame);
+            log.check();
+        }
+        CHECK_EQ(humidity.state, 35);
+        // Power-off: no frame in between, so a frame number would repeat
+        // the humidity change set's seq
+        dryer.run_until(ms + 1000);
+        log.check();
+        CHECK(dryer.device_state_ == DeviceState::OFF);
+        CHECK(strstr(snapshot.state.c_str(), "\"status\":\"Off\"") != nullptr);
+        ms += 1000;
+    }
+    // Power-on, humidity change and power-off per cycle
+    CHECK(log.published >= 6);
+}
+
+int main() {
+    test_unique_sequence();
+    return host_test_result();
+}
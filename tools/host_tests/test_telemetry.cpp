@@ -0,0 +1,193 @@
+/**
+ * Host test: UDP telemetry round trip
+ * Frames are encoded by the component's DryerTelemetry (dryer_telemetry.cpp,
+ * datagrams captured by the lwIP stubs) and decoded by
+ * tools/telemetry_receiver.py parse_datagram(), so the encoder and the
+ * receiver cannot drift apart from the layout in dryer_telemetry.h.
+ */
+
+#define USE_CREALITY_DRYER_TELEMETRY
+#include "dryer_telemetry.cpp"
+#include "host_test.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace esphome::i2c_creality_pi_dryer;
+
+static constexpr uint8_t FRAME_SIZE = DryerTelemetry::FRAME_SIZE;
+
+/**
+ * One frame as sent and as decoded
+ */
+struct Record {
+    uint32_t seq;
+    uint32_t ms;
+    uint8_t flags;
+    uint8_t bytes[FRAME_SIZE];
+
+    bool operator==(const Record &other) const {
+        return seq == other.seq && ms == other.ms && flags == other.flags &&
+               memcmp(bytes, other.bytes, FRAME_SIZE) == 0;
+    }
+};
+
+/**
+ * Exposes the pending batch size
+ */
+struct TestTelemetry : DryerTelemetry {
+    uint8_t pending() const { return count_; }
+};
+
+static void add(TestTelemetry &telemetry, const Record &record) {
+    volatile uint8_t bytes[FRAME_SIZE];
+    for (uint8_t i = 0; i < FRAME_SIZE; i++) bytes[i] = record.bytes[i];
+    telemetry.add_frame(bytes, record.seq, record.ms, record.flags);
+}
+
+/**
+ * Every captured datagram decoded by telemetry_receiver.py
+ */
+static std::vector<Record> decode_with_receiver() {
+    std::string tools = __FILE__;
+    tools = tools.substr(0, tools.rfind("/host_tests/"));
+    char path[] = "/tmp/dryer_telemetry_XXXXXX";
+    int fd = mkstemp(path);
+    CHECK(fd >= 0);
+    FILE *file = fdopen(fd, "w");
+    for (const auto &datagram : host_udp().datagrams) {
+        for (uint8_t byte : datagram) fprintf(file, "%02x", byte);
+        fputc('\n', file);
+    }
+    fclose(file);
+
+    std::string command = "python3 -c 'import sys; sys.path.insert(0, sys.argv[1])\n"
+                          "from telemetry_receiver import parse_datagram\n"
+                          "for line in open(sys.argv[2]):\n"
+                          "    for seq, ts, flags, frame in parse_datagram(bytes.fromhex(line.strip())):\n"
+                          "        print(seq, ts, flags, frame.hex())' " +
+                          tools + " " + path;
+    std::vector<Record> records;
+    FILE *pipe = popen(command.c_str(), "r");
+    CHECK(pipe != nullptr);
+    char line[128];
+    while (pipe && fgets(line, sizeof(line), pipe)) {
+        Record record{};
+        unsigned seq, ms, flags;
+        char hex[2 * FRAME_SIZE + 1];
+        CHECK(sscanf(line, "%u %u %u %44s", &seq, &ms, &flags, hex) == 4);
+        record.seq = seq;
+        record.ms = ms;
+        record.flags = flags;
+        for (uint8_t i = 0; i < FRAME_SIZE; i++) {
+            unsigned byte;
+            sscanf(hex + 2 * i, "%2x", &byte);
+            record.bytes[i] = byte;
+        }
+        records.push_back(record);
+    }
+    CHECK(pipe && pclose(pipe) == 0);
+    remove(path);
+    return records;
+}
+
+/**
+ * Display-like frames: mostly repeats, a few bytes changing, sequence gaps
+ * (frames lost before the encoder) and state changes in the flags
+ */
+static std::vector<Record> make_frames(size_t count, uint32_t changes_per_frame) {
+    std::vector<Record> frames;
+    Record record{};
+    record.seq = 1000;
+    record.ms = 50000;
+    uint32_t rng = 12345;
+    auto random = [&rng]() {
+        rng = rng * 1103515245u + 12345u;
+        return rng >> 16;
+    };
+    for (uint8_t i = 0; i < FRAME_SIZE; i++) record.bytes[i] = random();
+    for (size_t n = 0; n < count; n++) {
+        record.seq += random() % 10 == 0 ? 2 + random() % 5 : 1;
+        record.ms += 95 + random() % 11;
+        if (random() % 40 == 0) record.flags = (random() % 5) << 1 | (random() & 1);
+        for (uint32_t c = 0; c < changes_per_frame; c++) record.bytes[random() % FRAME_SIZE] = random();
+        frames.push_back(record);
+    }
+    return frames;
+}
+
+/**
+ * Small batches: every frame comes back with sequence, time and flags
+ */
+static void test_round_trip() {
+    host_udp() = HostUdp{};
+    TestTelemetry telemetry;
+    telemetry.configure("192.168.1.20", 5140, 16);
+    std::vector<Record> sent = make_frames(500, 1);
+    for (const Record &record : sent) add(telemetry, record);
+    telemetry.flush_if_due(sent.back().ms + DryerTelemetry::FLUSH_INTERVAL_MS);
+    CHECK_EQ(telemetry.pending(), 0);
+
+    CHECK_EQ(telemetry.get_datagrams_sent(), (500 + 15) / 16);
+    CHECK_EQ(host_udp().datagrams.size(), (500 + 15) / 16);
+    CHECK_EQ(ntohs(host_udp().last_dest.sin_port), 5140);
+    CHECK_EQ(host_udp().last_dest.sin_addr.s_addr, inet_addr("192.168.1.20"));
+
+    std::vector<Record> decoded = decode_with_receiver();
+    CHECK_EQ(decoded.size(), sent.size());
+    size_t mismatches = 0;
+    for (size_t i = 0; i < decoded.size() && i < sent.size(); i++) mismatches += !(decoded[i] == sent[i]);
+    CHECK_EQ(mismatches, 0);
+}
+
+/**
+ * Large batches of busy frames: datagrams are closed by size, never above
+ * DATAGRAM_SIZE, and still decode on their own
+ */
+static void test_size_limit() {
+    host_udp() = HostUdp{};
+    TestTelemetry telemetry;
+    telemetry.configure("10.0.0.1", 9000, 255);
+    std::vector<Record> sent = make_frames(300, 8);
+    for (const Record &record : sent) add(telemetry, record);
+    telemetry.flush_if_due(sent.back().ms + DryerTelemetry::FLUSH_INTERVAL_MS);
+
+    CHECK(host_udp().datagrams.size() > 1);
+    for (const auto &datagram : host_udp().datagrams) CHECK(datagram.size() <= DryerTelemetry::DATAGRAM_SIZE);
+    std::vector<Record> decoded = decode_with_receiver();
+    CHECK_EQ(decoded.size(), sent.size());
+    size_t mismatches = 0;
+    for (size_t i = 0; i < decoded.size() && i < sent.size(); i++) mismatches += !(decoded[i] == sent[i]);
+    CHECK_EQ(mismatches, 0);
+}
+
+/**
+ * A gap above 65535 ms is saturated in the record, a failed send drops the
+ * batch and is counted
+ */
+static void test_saturation_and_errors() {
+    host_udp() = HostUdp{};
+    TestTelemetry telemetry;
+    telemetry.configure("10.0.0.1", 9000, 2);
+    std::vector<Record> sent = make_frames(2, 1);
+    sent[1].ms = sent[0].ms + 70000;
+    for (const Record &record : sent) add(telemetry, record);
+    std::vector<Record> decoded = decode_with_receiver();
+    CHECK_EQ(decoded.size(), 2);
+    if (decoded.size() == 2) CHECK_EQ(decoded[1].ms, sent[0].ms + 0xFFFF);
+
+    host_udp().fail = true;
+    for (const Record &record : sent) add(telemetry, record);
+    CHECK_EQ(telemetry.get_send_errors(), 1);
+    CHECK_EQ(telemetry.get_datagrams_sent(), 1);
+    CHECK_EQ(telemetry.pending(), 0);
+}
+
+int main() {
+    test_round_trip();
+    test_size_limit();
+    test_saturation_and_errors();
+    return host_test_result();
+}
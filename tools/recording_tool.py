@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""
+Creality Pi Dryer frame recording tool
+======================================
+Downloads the raw frame recording kept in flash by the i2c_creality_pi_dryer
+component (recorder: block in YAML) and decodes it back into the exact
+22-byte frames with their exact timestamps, one JSON line per frame, for
+offline replay and analysis. The --hex output is the frame file format of
+filter_replay, host_bench and filter_tuner.py (which also reads .bin files).
+
+Usage:
+    # Fetch all sectors (oldest first) from /dryer/recording into one file
+    python3 recording_tool.py download --host 192.168.1.50 recording.bin
+
+    # Print frames as JSON lines (add --hex for plain "<ms> <hex>" lines)
+    python3 recording_tool.py decode recording.bin [--hex]
+
+Sector and record layout is documented in
+external_components/i2c_creality_pi_dryer/dryer_recorder.h
+"""
+
+import argparse
+import json
+import struct
+import sys
+import urllib.request
+
+MAGIC = 0x32525043          # 'CPR2'
+MAGIC_V1 = 0x46525043       # 'CPRF': first format, repeat timestamps interpolated
+SECTOR_SIZE = 4096
+FRAME_SIZE = 22
+HEADER = struct.Struct("<III")
+
+
+def download(host, out_path):
+    """Fetch every used sector in ring order and concatenate them"""
+    base = f"http://{host}/dryer/recording"
+    with urllib.request.urlopen(base, timeout=10) as response:
+        info = json.load(response)
+    used = info["used"]
+    with open(out_path, "wb") as out:
+        for index in range(used):
+            with urllib.request.urlopen(f"{base}?sector={index}", timeout=10) as response:
+                data = response.read()
+            if len(data) != SECTOR_SIZE:
+                raise SystemExit(f"sector {index}: expected {SECTOR_SIZE} bytes, got {len(data)}")
+            out.write(data)
+            print(f"sector {index + 1}/{used}", file=sys.stderr)
+    return used
+
+
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if byte < 0x80:
+            return value, pos
+        shift += 7
+
+
+def is_sector(sector):
+    return HEADER.unpack_from(sector)[0] in (MAGIC, MAGIC_V1)
+
+
+def decode_sector(sector):
+    """Yield (timestamp_ms, frame bytes) for every frame of one sector"""
+    magic, sequence, now = HEADER.unpack_from(sector)
+    if magic not in (MAGIC, MAGIC_V1):
+        return
+    pos = HEADER.size
+    frame = None
+    try:
+        while pos < len(sector) and sector[pos] != 0xFF:
+            tag = sector[pos]
+            pos += 1
+            if tag == 0x00:
+                dt, pos = read_varint(sector, pos)
+                frame = bytearray(sector[pos:pos + FRAME_SIZE])
+                pos += FRAME_SIZE
+                now = (now + dt) & 0xFFFFFFFF
+                yield now, bytes(frame)
+            elif tag == 0x01 and frame is not None:
+                dt, pos = read_varint(sector, pos)
+                mask = sector[pos] | (sector[pos + 1] << 8) | (sector[pos + 2] << 16)
+                pos += 3
+                for i in range(FRAME_SIZE):
+                    if mask & (1 << i):
+                        frame[i] = sector[pos]
+                        pos += 1
+                now = (now + dt) & 0xFFFFFFFF
+                yield now, bytes(frame)
+            elif tag & 0x80 and frame is not None and magic == MAGIC:
+                # Repeat run: one timestamp per repeat
+                for _ in range(tag & 0x7F):
+                    dt, pos = read_varint(sector, pos)
+                    now = (now + dt) & 0xFFFFFFFF
+                    yield now, bytes(frame)
+            elif tag & 0x80 and frame is not None:
+                # First format: only the run's end time, spread evenly over the run
+                count = tag & 0x7F
+                dt, pos = read_varint(sector, pos)
+                for i in range(1, count + 1):
+                    yield (now + dt * i // count) & 0xFFFFFFFF, bytes(frame)
+                now = (now + dt) & 0xFFFFFFFF
+            else:
+                print(f"sector {sequence}: bad tag 0x{tag:02X} at {pos - 1}", file=sys.stderr)
+                return
+    except IndexError:
+        # A flush interrupted by reset leaves a truncated tail; keep what decoded
+        print(f"sector {sequence}: truncated record", file=sys.stderr)
+
+
+def read_recording(path):
+    """Yield (timestamp_ms, frame bytes) for every frame of a downloaded recording"""
+    with open(path, "rb") as handle:
+        data = handle.read()
+    sectors = [data[i:i + SECTOR_SIZE] for i in range(0, len(data) - SECTOR_SIZE + 1, SECTOR_SIZE)]
+    # Order by sector sequence (download already is oldest first, raw dumps may not be)
+    sectors = [s for s in sectors if is_sector(s)]
+    sectors.sort(key=lambda s: HEADER.unpack_from(s)[1])
+    for sector in sectors:
+        yield from decode_sector(sector)
+
+
+def decode(path, as_hex):
+    count = 0
+    for timestamp, frame in read_recording(path):
+        if as_hex:
+            print(f"{timestamp} {frame.hex()}")
+        else:
+            print(json.dumps({"ms": timestamp, "frame": frame.hex()}))
+        count += 1
+    print(f"{count} frames", file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command", required=True)
+    fetch = commands.add_parser("download", help="Download the recording from the device")
+    fetch.add_argument("--host", required=True, help="Device IP address or hostname")
+    fetch.add_argument("output", help="Output file")
+    dump = commands.add_parser("decode", help="Decode a downloaded recording")
+    dump.add_argument("input", help="Recording file")
+    dump.add_argument("--hex", action="store_true", help="Print '<ms> <hex>' lines instead of JSON")
+    args = parser.parse_args()
+
+    if args.command == "download":
+        download(args.host, args.output)
+    else:
+        decode(args.input, args.hex)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""
+Creality Pi Dryer telemetry receiver
+====================================
+Receives the binary UDP telemetry stream produced by the i2c_creality_pi_dryer
+component (telemetry: block in YAML), reconstructs the raw 22-byte frames from
+the delta-encoded records and prints them as JSON lines, one per frame.
+
+Usage:
+    python3 telemetry_receiver.py [--bind 0.0.0.0] [--port 5140] [--raw] [--stats]
+
+Without a dryer, tools/telemetry_sender.py feeds it recorded or synthetic frames.
+
+Datagram layout is documented in external_components/i2c_creality_pi_dryer/dryer_telemetry.h
+"""
+
+import argparse
+import json
+import socket
+import struct
+import sys
+import time
+
+MAGIC = 0x54445043          # 'CPDT'
+VERSION = 1
+FRAME_SIZE = 22
+HEADER = struct.Struct("<IBBHII")
+RECORD = struct.Struct("<BBHI")
+
+# Decoding tables (must match SpacePiPlusProtocol in dryer_protocol.h)
+DIGITS = [0xAF, 0xA0, 0xCB, 0xE9, 0xE4, 0x6D, 0x6F, 0xA8, 0xEF, 0xED, 0x4F]
+MATERIAL_XOR = [0x27, 0x37, 0xEB, 0xFD, 0xE3, 0x19, 0x83, 0xFE, 0xF3, 0x93, 0x97, 0xE1]
+MATERIAL_NAME = ["ABS", "ASA", "PETG", "PC", "PA", "PET",
+                 "PLA-CF", "PETG-CF", "PA-CF", "PLA", "TPU", "PP"]
+STATES = ["Off", "Starting", "Idle", "Drying", "Error"]
+
+
+def decode_digit(high, low):
+    """Exact-match decode of a two-digit 7-segment field (None if invalid)"""
+    masked = [d & 0xEF for d in DIGITS]
+    try:
+        dh = masked.index(high & 0xEF)
+        dl = masked.index(low & 0xEF)
+    except ValueError:
+        return None
+    if dh == 10:
+        return "E%d" % dl
+    return dh * 10 + dl
+
+
+def decode_frame(frame):
+    """Decode the main fields of a raw frame"""
+    mat_xor = 0
+    for b in frame[8:14]:
+        mat_xor ^= b
+    material = MATERIAL_NAME[MATERIAL_XOR.index(mat_xor)] if mat_xor in MATERIAL_XOR else None
+    hh = decode_digit(frame[16], frame[17])
+    mm = decode_digit(frame[18], frame[19])
+    ss = decode_digit(frame[20], frame[21])
+    time_str = None
+    if all(isinstance(v, int) for v in (hh, mm, ss)):
+        time_str = "%02d:%02d:%02d" % (hh, mm, ss)
+    return {
+        "sv": decode_digit(frame[3], frame[4]),
+        "pv": decode_digit(frame[5], frame[6]),
+        "rh": decode_digit(frame[14], frame[15]),
+        "time": time_str,
+        "material": material,
+    }
+
+
+def parse_datagram(data):
+    """Yield (sequence, timestamp_ms, flags, frame) tuples from one datagram"""
+    if len(data) < HEADER.size:
+        raise ValueError("short datagram")
+    magic, version, count, _, seq, ts = HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("bad magic/version")
+    offset = HEADER.size
+    frame = bytearray(FRAME_SIZE)
+    for _ in range(count):
+        flags, seq_delta, dt_ms, mask = RECORD.unpack_from(data, offset)
+        offset += RECORD.size
+        seq += seq_delta
+        ts += dt_ms
+        for i in range(FRAME_SIZE):
+            if mask & (1 << i):
+                frame[i] = data[offset]
+                offset += 1
+        yield seq, ts, flags, bytes(frame)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--bind", default="0.0.0.0", help="Address to listen on")
+    parser.add_argument("--port", type=int, default=5140, help="UDP port to listen on")
+    parser.add_argument("--raw", action="store_true", help="Print raw frame hex instead of decoded fields")
+    parser.add_argument("--stats", action="store_true", help="Print throughput once per second instead of frames")
+    args = parser.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind((args.bind, args.port))
+
+    frames = datagrams = octets = errors = 0
+    last_seq = None
+    gaps = 0
+    window_start = time.monotonic()
+
+    while True:
+        data, _ = sock.recvfrom(2048)
+        datagrams += 1
+        octets += len(data)
+        try:
+            for seq, ts, flags, frame in parse_datagram(data):
+                frames += 1
+                if last_seq is not None and seq != last_seq + 1:
+                    gaps += 1
+                last_seq = seq
+                if args.stats:
+                    continue
+                state = (flags >> 1) & 0x07
+                record = {"seq": seq, "ts": ts, "state": STATES[state] if state < len(STATES) else None,
+                          "error": bool(flags & 0x01)}
+                if args.raw:
+                    record["frame"] = frame.hex()
+                else:
+                    record.update(decode_frame(frame))
+                print(json.dumps(record), flush=True)
+        except (ValueError, struct.error) as err:
+            errors += 1
+            print("bad datagram: %s" % err, file=sys.stderr)
+
+        if args.stats:
+            elapsed = time.monotonic() - window_start
+            if elapsed >= 1.0:
+                print("%.1f frames/s  %.1f datagrams/s  %.0f B/s  %.1f B/frame  gaps=%d errors=%d" % (
+                    frames / elapsed, datagrams / elapsed, octets / elapsed,
+                    octets / frames if frames else 0.0, gaps, errors), flush=True)
+                frames = datagrams = octets = 0
+                window_start = time.monotonic()
+
+
+if __name__ == "__main__":
+    main()
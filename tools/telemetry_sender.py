@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""
+Creality Pi Dryer telemetry sender
+==================================
+Stands in for the i2c_creality_pi_dryer component on the host: encodes raw
+22-byte frames exactly like DryerTelemetry::add_frame() and sends them as UDP
+datagrams, so the receiver and its throughput figures can be checked without
+a dryer.
+
+Usage:
+    # Terminal 1: receiver in throughput mode
+    python3 telemetry_receiver.py --port 5140 --stats
+
+    # Terminal 2: replay a recording at its recorded pace ...
+    python3 recording_tool.py decode recording.bin --hex > frames.txt
+    python3 telemetry_sender.py --frames frames.txt
+
+    # ... or synthetic drying frames at a fixed rate for 10 s
+    python3 telemetry_sender.py --rate 50 --duration 10 --batch-size 16
+
+Frames files hold "<ms> <hex>" lines (recording_tool.py decode --hex). Without
+--frames a drying display is synthesized: PV climbing towards SV, the timer
+counting down and the colon blinking, i.e. a few changed bytes per frame as
+on the real bus.
+
+Datagram layout is documented in external_components/i2c_creality_pi_dryer/dryer_telemetry.h
+"""
+
+import argparse
+import socket
+import sys
+import time
+
+from telemetry_receiver import DIGITS, FRAME_SIZE, HEADER, MAGIC, RECORD, VERSION
+
+# Must match DryerTelemetry in dryer_telemetry.h
+DATAGRAM_SIZE = 512
+FLUSH_INTERVAL_MS = 1000
+
+# Frame layout (must match SpacePiPlusProtocol in dryer_protocol.h)
+ADDRESS = 0x7E
+BASE_FRAME = bytes([ADDRESS, 0x00, 0x00]) + bytes(FRAME_SIZE - 3)
+STATE_DRYING = 3
+MATERIAL_PLA = 0x93         # XOR of frame bytes 8..13
+
+
+class TelemetryEncoder:
+    """Batches frames into datagrams the same way as DryerTelemetry"""
+
+    def __init__(self, batch_size):
+        self.batch_size = batch_size
+        self.records = bytearray()
+        self.count = 0
+        self.base_seq = self.base_ms = 0
+        self.prev_frame = bytes(FRAME_SIZE)
+        self.prev_seq = self.prev_ms = 0
+
+    def add_frame(self, frame, seq, ms, flags):
+        """Append a record, return the datagrams completed by it"""
+        out = []
+        if self.count > 0 and HEADER.size + len(self.records) + RECORD.size + FRAME_SIZE > DATAGRAM_SIZE:
+            out.append(self.flush())
+        keyframe = self.count == 0
+        if keyframe:
+            self.base_seq, self.base_ms = seq, ms
+        mask = 0
+        for i in range(FRAME_SIZE):
+            if keyframe or frame[i] != self.prev_frame[i]:
+                mask |= 1 << i
+        dt = 0 if keyframe else (ms - self.prev_ms) & 0xFFFFFFFF
+        seq_delta = 0 if keyframe else (seq - self.prev_seq) & 0xFF
+        self.records += RECORD.pack(flags, seq_delta, min(dt, 0xFFFF), mask)
+        self.records += bytes(frame[i] for i in range(FRAME_SIZE) if mask & (1 << i))
+        self.prev_frame, self.prev_seq, self.prev_ms = bytes(frame), seq, ms
+        self.count += 1
+        if self.count >= self.batch_size:
+            out.append(self.flush())
+        return out
+
+    def flush_if_due(self, now_ms):
+        """Return the pending datagram if its first record is too old"""
+        if self.count > 0 and now_ms - self.base_ms >= FLUSH_INTERVAL_MS:
+            return [self.flush()]
+        return []
+
+    def flush(self):
+        datagram = HEADER.pack(MAGIC, VERSION, self.count, 0, self.base_seq, self.base_ms) + self.records
+        self.records = bytearray()
+        self.count = 0
+        return datagram
+
+
+def load_frames(path):
+    """Yield (ms, frame) from "<ms> <hex>" lines"""
+    with open(path) as f:
+        for line in f:
+            parts = line.split()
+            if len(parts) != 2:
+                continue
+            frame = bytes.fromhex(parts[1])
+            if len(frame) == FRAME_SIZE:
+                yield int(parts[0]), frame
+
+
+def digits(value):
+    return DIGITS[value // 10], DIGITS[value % 10]
+
+
+def synthetic_frames(rate, duration):
+    """Yield (ms, frame) of a drying display at the given frame rate"""
+    period = 1000.0 / rate
+    remaining = 4 * 3600
+    for n in range(int(duration * rate)):
+        ms = int(n * period)
+        frame = bytearray(BASE_FRAME)
+        frame[3], frame[4] = digits(50)
+        frame[5], frame[6] = digits(min(50, 25 + ms // 2000))
+        frame[8] = MATERIAL_PLA
+        frame[14], frame[15] = digits(12)
+        left = remaining - ms // 1000
+        frame[16], frame[17] = digits(left // 3600)
+        frame[18], frame[19] = digits(left // 60 % 60)
+        frame[20], frame[21] = digits(left % 60)
+        if (ms // 500) % 2:
+            frame[18] |= 0x10   # Colon segment blinks at 1 Hz
+        yield ms, bytes(frame)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="127.0.0.1", help="Receiver address")
+    parser.add_argument("--port", type=int, default=5140, help="Receiver UDP port")
+    parser.add_argument("--batch-size", type=int, default=16, help="Max frames per datagram (as in YAML)")
+    parser.add_argument("--frames", help="'<ms> <hex>' frames file (default: synthetic frames)")
+    parser.add_argument("--rate", type=float, default=20.0, help="Synthetic frames per second")
+    parser.add_argument("--duration", type=float, default=10.0, help="Synthetic run length in seconds")
+    parser.add_argument("--speed", type=float, default=1.0, help="Replay speed factor (0 = as fast as possible)")
+    args = parser.parse_args()
+
+    frames = load_frames(args.frames) if args.frames else synthetic_frames(args.rate, args.duration)
+    encoder = TelemetryEncoder(args.batch_size)
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    dest = (args.host, args.port)
+
+    sent = octets = count = 0
+    start = time.monotonic()
+    first_ms = None
+    for seq, (ms, frame) in enumerate(frames):
+        if first_ms is None:
+            first_ms = ms
+        if args.speed > 0:
+            delay = (ms - first_ms) / 1000.0 / args.speed - (time.monotonic() - start)
+            if delay > 0:
+                time.sleep(delay)
+        datagrams = encoder.flush_if_due(ms)
+        datagrams += encoder.add_frame(frame, seq, ms, STATE_DRYING << 1)
+        for datagram in datagrams:
+            sock.sendto(datagram, dest)
+            sent += 1
+            octets += len(datagram)
+        count += 1
+    if encoder.count:
+        datagram = encoder.flush()
+        sock.sendto(datagram, dest)
+        sent += 1
+        octets += len(datagram)
+
+    elapsed = time.monotonic() - start
+    print("%d frames in %d datagrams, %d B (%.1f B/frame) in %.1f s" % (
+        count, sent, octets, octets / count if count else 0.0, elapsed), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()